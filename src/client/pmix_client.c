@@ -165,6 +165,10 @@ static void pmix_client_notify_recv(struct pmix_peer_t *peer, pmix_ptl_hdr_t *hd
         return;
     }
 
+    /* the event may signal that data we could not find
+     * before is now available */
+    pmix_client_negcache_flush();
+
     /* start the local notification chain */
     chain = PMIX_NEW(pmix_event_chain_t);
     if (NULL == chain) {
@@ -234,6 +238,11 @@ static void pmix_client_notify_recv(struct pmix_peer_t *peer, pmix_ptl_hdr_t *hd
                         "%s pmix:client_notify_recv - processing event %s, calling errhandler",
                         PMIX_NAME_PRINT(&pmix_globals.myid), PMIx_Error_string(chain->status));
 
+    /* if duplicates of this event are being merged, then it
+     * will be delivered when its window closes */
+    if (pmix_event_coalesce_chain(chain)) {
+        return;
+    }
     pmix_invoke_local_event_hdlr(chain);
     return;
 
@@ -257,6 +266,11 @@ pmix_client_globals_t pmix_client_globals = {
     .singleton = false,
     .pending_requests = PMIX_LIST_STATIC_INIT,
     .peers = PMIX_POINTER_ARRAY_STATIC_INIT,
+    .negcache = PMIX_HASH_TABLE_STATIC_INIT,
+    .get_cache = false,
+    .get_cache_hits = 0,
+    .get_negcache_hits = 0,
+    .get_server_reqs = 0,
     .get_output = -1,
     .get_verbose = 0,
     .connect_output = -1,
@@ -662,6 +676,8 @@ PMIX_EXPORT pmix_status_t PMIx_Init(pmix_proc_t *proc, pmix_info_t info[], size_
     PMIX_CONSTRUCT(&pmix_client_globals.pending_requests, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_client_globals.peers, pmix_pointer_array_t);
     pmix_pointer_array_init(&pmix_client_globals.peers, 1, INT_MAX, 1);
+    PMIX_CONSTRUCT(&pmix_client_globals.negcache, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_client_globals.negcache, 256);
     pmix_client_globals.myserver = PMIX_NEW(pmix_peer_t);
     if (NULL == pmix_client_globals.myserver) {
         pmix_init_result = PMIX_ERR_NOMEM;
@@ -1112,6 +1128,7 @@ PMIX_EXPORT pmix_status_t PMIx_Finalize(const pmix_info_t info[], size_t ninfo)
         }
     }
     PMIX_DESTRUCT(&pmix_client_globals.peers);
+    PMIX_DESTRUCT(&pmix_client_globals.negcache);
     if (pmix_client_globals.singleton) {
         PMIX_LIST_DESTRUCT(&pmix_server_globals.iof);
         PMIX_LIST_DESTRUCT(&pmix_server_globals.iof_residuals);
@@ -1336,6 +1353,8 @@ static void _commitfn(int sd, short args, void *cbdata)
 
     PMIX_HIDE_UNUSED_PARAMS(sd, args);
 
+    pmix_client_negcache_flush();
+
     msgout = PMIX_NEW(pmix_buffer_t);
     /* pack the cmd */
     PMIX_BFROPS_PACK(rc, pmix_client_globals.myserver, msgout, &cmd, 1, PMIX_COMMAND);
@@ -264,6 +264,9 @@ static void wait_cbfunc(struct pmix_peer_t *pr, pmix_ptl_hdr_t *hdr, pmix_buffer
         rc = unpack_return(buf);
     }
 
+    /* the fence may have brought in data we could not find before */
+    pmix_client_negcache_flush();
+
     /* if a callback was provided, execute it */
     if (NULL != cb->cbfunc.opfn) {
         cb->cbfunc.opfn(rc, cb->cbdata);
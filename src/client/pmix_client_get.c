@@ -74,6 +74,50 @@ static pmix_status_t process_values(pmix_cb_t *cb);
 
 static pmix_status_t refresh_cache(void);
 
+/* the negative cache is keyed by the nspace, rank, and key */
+#define PMIX_NEGCACHE_KEY_MAX (PMIX_MAX_NSLEN + sizeof(pmix_rank_t) + PMIX_MAX_KEYLEN)
+
+static size_t negcache_key(const pmix_proc_t *proc, const char *key, char *buf)
+{
+    size_t nlen = pmix_nslen(proc->nspace);
+    size_t klen = pmix_keylen(key);
+
+    memcpy(buf, proc->nspace, nlen);
+    memcpy(buf + nlen, &proc->rank, sizeof(pmix_rank_t));
+    memcpy(buf + nlen + sizeof(pmix_rank_t), key, klen);
+    return nlen + sizeof(pmix_rank_t) + klen;
+}
+
+static bool negcache_check(const pmix_proc_t *proc, const char *key)
+{
+    char buf[PMIX_NEGCACHE_KEY_MAX];
+    size_t len;
+    void *ptr;
+
+    if (0 == pmix_hash_table_get_size(&pmix_client_globals.negcache)) {
+        return false;
+    }
+    len = negcache_key(proc, key, buf);
+    return (PMIX_SUCCESS == pmix_hash_table_get_value_ptr(&pmix_client_globals.negcache,
+                                                          buf, len, &ptr));
+}
+
+static void negcache_add(const pmix_proc_t *proc, const char *key)
+{
+    char buf[PMIX_NEGCACHE_KEY_MAX];
+    size_t len;
+
+    len = negcache_key(proc, key, buf);
+    pmix_hash_table_set_value_ptr(&pmix_client_globals.negcache, buf, len, NULL);
+}
+
+void pmix_client_negcache_flush(void)
+{
+    if (0 < pmix_hash_table_get_size(&pmix_client_globals.negcache)) {
+        pmix_hash_table_remove_all(&pmix_client_globals.negcache);
+    }
+}
+
 static pmix_status_t process_request(const pmix_proc_t *proc, const char key[],
                                      const pmix_info_t info[], size_t ninfo,
                                      pmix_get_logic_t *lg, pmix_value_t **val)
@@ -118,6 +162,7 @@ static pmix_status_t process_request(const pmix_proc_t *proc, const char key[],
         }
     }
 
+    lg->use_cache = pmix_client_globals.get_cache;
     for (n = 0; n < ninfo; n++) {
         if (PMIX_CHECK_KEY(&info[n], PMIX_GET_POINTER_VALUES)) {
             /* they want a pointer to the answer */
@@ -140,6 +185,8 @@ static pmix_status_t process_request(const pmix_proc_t *proc, const char key[],
         } else if (PMIX_CHECK_KEY(&info[n], PMIX_GET_REFRESH_CACHE)) {
             /* immediately query the server */
             lg->refresh_cache = PMIX_INFO_TRUE(&info[n]);
+        } else if (PMIX_CHECK_KEY(&info[n], PMIX_GET_CACHE)) {
+            lg->use_cache = PMIX_INFO_TRUE(&info[n]);
         } else if (PMIX_CHECK_KEY(&info[n], PMIX_JOB_INFO)) {
             /* regardless of the default setting, they want us
              * to get it from the job realm */
@@ -524,6 +571,7 @@ static void _getnb_cbfunc(struct pmix_peer_t *pr, pmix_ptl_hdr_t *hdr,
     int32_t cnt;
     pmix_kval_t *kv;
     pmix_get_logic_t *lg;
+    pmix_proc_t proc;
 
     PMIX_ACQUIRE_OBJECT(cb);
     PMIX_HIDE_UNUSED_PARAMS(pr, hdr);
@@ -573,13 +621,19 @@ done:
     /* now search any pending requests (including the one this was in
      * response to) to see if they can be met. Note that this function
      * will only be called if the user requested a specific key - we
-     * don't support calls to "get" for a NULL key */
+     * don't support calls to "get" for a NULL key. Completing the
+     * request we were called for releases its logic, so keep a copy
+     * of the proc */
     pmix_output_verbose(2, pmix_client_globals.get_output,
                         "pmix: get_nb looking for requested key");
+    PMIX_XFER_PROCID(&proc, &lg->p);
     PMIX_LIST_FOREACH_SAFE (cb, cb2, &pmix_client_globals.pending_requests, pmix_cb_t) {
-        if (PMIX_CHECK_NSPACE(lg->p.nspace, cb->pname.nspace) && cb->pname.rank == lg->p.rank) {
+        if (PMIX_CHECK_NSPACE(proc.nspace, cb->pname.nspace) && cb->pname.rank == proc.rank) {
             pmix_list_remove_item(&pmix_client_globals.pending_requests, &cb->super);
             if (PMIX_SUCCESS != ret) {
+                if (PMIX_ERR_NOT_FOUND == ret && NULL != cb->key && cb->lg->use_cache) {
+                    negcache_add(&proc, cb->key);
+                }
                 if (cb->checked) {
                     cb->status = ret;
                     gcbfn(0, 0, cb);
@@ -589,7 +643,7 @@ done:
                 continue;
             }
             /* we have the data for this proc - see if we can find the key */
-            cb->proc = &lg->p;
+            cb->proc = &proc;
             cb->scope = PMIX_SCOPE_UNDEF;
             pmix_output_verbose(2, pmix_client_globals.get_output,
                                 "pmix: get_nb searching for key %s for rank %s", cb->key,
@@ -612,6 +666,9 @@ done:
                     }
                }
             }
+            if (PMIX_ERR_NOT_FOUND == rc && NULL != cb->key && cb->lg->use_cache) {
+                negcache_add(&proc, cb->key);
+            }
             if (PMIX_SUCCESS == rc) {
                 if (1 != pmix_list_get_size(&cb->kvs)) {
                     rc = PMIX_ERR_INVALID_VAL;
@@ -969,7 +1026,7 @@ doget:
         pmix_output_verbose(5, pmix_client_globals.get_output,
                             "pmix:client data found in server-provided data");
         cb->status = process_values(cb);
-        goto done;
+        goto found;
     }
     pmix_output_verbose(5, pmix_client_globals.get_output,
                         "pmix:client data NOT found in server-provided data");
@@ -984,7 +1041,7 @@ doget:
             pmix_output_verbose(5, pmix_client_globals.get_output,
                                 "pmix:client data found in internal hash data");
             cb->status = process_values(cb);
-            goto done;
+            goto found;
         }
     }
     pmix_output_verbose(5, pmix_client_globals.get_output,
@@ -1052,6 +1109,18 @@ doget:
         goto done;
     }
 
+    /* if the server already told us it doesn't have this key,
+     * then there is no point in asking again */
+    if (lg->use_cache && !lg->refresh_cache && NULL != cb->key
+        && negcache_check(&lg->p, cb->key)) {
+        pmix_output_verbose(2, pmix_client_globals.get_output,
+                            "PMIx_Get key=%s for rank = %u, namespace = %s was not found - cached",
+                            cb->key, cb->pname.rank, cb->pname.nspace);
+        pmix_client_globals.get_negcache_hits++;
+        cb->status = PMIX_ERR_NOT_FOUND;
+        goto done;
+    }
+
     /* see if we already have a request in place with the server for data from
      * this nspace:rank. If we do, then no need to ask again as the
      * request will return _all_ data from that proc */
@@ -1087,8 +1156,16 @@ doget:
         cb->status = PMIX_ERROR;
         goto done;
     }
+    pmix_client_globals.get_server_reqs++;
     return;
 
+found:
+    /* count the round trips we saved on other procs' data */
+    if (NULL != cb->key && !PMIX_CHECK_RESERVED_KEY(cb->key)
+        && !PMIX_CHECK_PROCID(&lg->p, &pmix_globals.myid)) {
+        pmix_client_globals.get_cache_hits++;
+    }
+
 done:
     /* we made a lot of changes to cb, so ensure they get
      * written out before we return */
@@ -13,6 +13,7 @@
 
 #include "src/include/pmix_config.h"
 
+#include "src/class/pmix_hash_table.h"
 #include "src/class/pmix_list.h"
 #include "src/class/pmix_pointer_array.h"
 #include "src/common/pmix_iof.h"
@@ -26,6 +27,11 @@ typedef struct {
     bool singleton;               // no server
     pmix_list_t pending_requests; // list of pmix_cb_t pending data requests
     pmix_pointer_array_t peers;   // array of pmix_peer_t cached for data ops
+    pmix_hash_table_t negcache;   // proc:key pairs the server reported as not found
+    bool get_cache;               // default for PMIX_GET_CACHE
+    uint64_t get_cache_hits;      // gets for other procs' data satisfied locally
+    uint64_t get_negcache_hits;   // gets answered from the negative cache
+    uint64_t get_server_reqs;     // gets that required a request to the server
     // verbosity for client get operations
     int get_output;
     int get_verbose;
@@ -57,6 +63,10 @@ typedef struct {
 
 PMIX_EXPORT extern pmix_client_globals_t pmix_client_globals;
 
+/* forget every "not found" result we have cached - called whenever
+ * data we could not find before may have become available */
+PMIX_EXPORT void pmix_client_negcache_flush(void);
+
 END_C_DECLS
 
 #endif /* PMIX_CLIENT_OPS_H */
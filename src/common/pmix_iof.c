@@ -22,6 +22,9 @@
 #        include <sys/fcntl.h>
 #    endif
 #endif
+#ifdef HAVE_SYS_IOCTL_H
+#    include <sys/ioctl.h>
+#endif
 #include <ctype.h>
 
 #include "src/include/pmix_socket_errno.h"
@@ -1061,411 +1064,401 @@ pmix_status_t pmix_iof_process_iof(pmix_iof_channel_t channels, const pmix_proc_
     return PMIX_OPERATION_SUCCEEDED;
 }
 
-static pmix_status_t write_output_line(const pmix_proc_t *name,
-                                       pmix_iof_write_event_t *channel,
-                                       pmix_iof_flags_t *myflags,
-                                       pmix_iof_channel_t stream,
-                                       bool copystdout, bool copystderr,
-                                       const pmix_byte_object_t *bo)
+/* fetch the hostname and pid of a source for detailed tagging */
+static void iof_fetch_source(const pmix_proc_t *name, char **hostname, char **pidstring)
 {
-    char starttag[PMIX_IOF_BASE_TAG_MAX], endtag[PMIX_IOF_BASE_TAG_MAX], *suffix;
-    char timestamp[PMIX_IOF_BASE_TAG_MAX], outtag[PMIX_IOF_BASE_TAG_MAX];
-    char begintag[PMIX_IOF_BASE_TAG_MAX];
-    char **segments = NULL;
-    pmix_iof_write_output_t *output, *copy;
-    size_t offset, j, n, m, bufsize;
-    char *buffer, qprint[15], *cptr;
-    const char *usestring;
-    bool bufcopy;
     pmix_cb_t cb2;
     pmix_info_t optional;
     pmix_kval_t *kv;
     pid_t pid;
-    char *pidstring;
     pmix_status_t rc;
 
-    /* setup output object */
-    output = PMIX_NEW(pmix_iof_write_output_t);
-    memset(begintag, 0, PMIX_IOF_BASE_TAG_MAX);
-    memset(starttag, 0, PMIX_IOF_BASE_TAG_MAX);
-    memset(endtag, 0, PMIX_IOF_BASE_TAG_MAX);
-    memset(timestamp, 0, PMIX_IOF_BASE_TAG_MAX);
-    memset(outtag, 0, PMIX_IOF_BASE_TAG_MAX);
     PMIX_INFO_LOAD(&optional, PMIX_OPTIONAL, NULL, PMIX_BOOL);
-
-    /* write output data to the corresponding tag */
-    if (PMIX_FWD_STDIN_CHANNEL & stream) {
-        /* copy over the data to be written */
-        if (0 < bo->size) {
-            /* don't copy 0 bytes - we just need to pass
-             * the zero bytes so the fd can be closed
-             * after it writes everything out
-             */
-            output->data = (char*)malloc(bo->size);
-            memcpy(output->data, bo->bytes, bo->size);
+    *hostname = NULL;
+    *pidstring = NULL;
+
+    PMIX_CONSTRUCT(&cb2, pmix_cb_t);
+    cb2.proc = (pmix_proc_t*)name;
+    cb2.key = PMIX_HOSTNAME;
+    cb2.info = &optional;
+    cb2.ninfo = 1;
+    PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
+    if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
+        kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
+        if (NULL != kv) {  // should never be NULL
+            *hostname = strdup(kv->value->data.string);
+            PMIX_RELEASE(kv);
+        }
+    }
+    PMIX_DESTRUCT(&cb2);
+    if (NULL == *hostname) {
+        *hostname = strdup("unknown");
+    }
+
+    PMIX_CONSTRUCT(&cb2, pmix_cb_t);
+    cb2.proc = (pmix_proc_t*)name;
+    cb2.key = PMIX_PROC_PID;
+    cb2.info = &optional;
+    cb2.ninfo = 1;
+    PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
+    if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
+        kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
+        if (NULL != kv) { // should never be NULL
+            PMIX_VALUE_GET_NUMBER(rc, kv->value, pid, pid_t);
+            PMIX_RELEASE(kv);
+            if (PMIX_SUCCESS == rc) {
+                pmix_asprintf(pidstring, "%u", pid);
+            }
         }
-        output->numbytes = bo->size;
-        goto process;
-    } else if (PMIX_FWD_STDOUT_CHANNEL & stream) {
-        /* write the bytes to stdout */
-        suffix = "stdout";
-    } else if (PMIX_FWD_STDERR_CHANNEL & stream) {
-        /* write the bytes to stderr */
-        suffix = "stderr";
-    } else if (PMIX_FWD_STDDIAG_CHANNEL & stream) {
-        /* write the bytes to stderr */
-        suffix = "stddiag";
-    } else {
-        /* error - this should never happen */
-        PMIX_ERROR_LOG(PMIX_ERR_VALUE_OUT_OF_BOUNDS);
-        PMIX_OUTPUT_VERBOSE((1, pmix_client_globals.iof_output, "%s stream %0x",
-                             PMIX_NAME_PRINT(&pmix_globals.myid), stream));
-        return PMIX_ERR_VALUE_OUT_OF_BOUNDS;
     }
-
-    /* if 0 bytes, then just pass it so the fd can be closed
-     * after it writes everything out
-     */
-    if (0 == bo->size) {
-        output->numbytes = 0;
-        goto process;
+    PMIX_DESTRUCT(&cb2);
+    if (NULL == *pidstring) {
+        *pidstring = strdup("unknown");
     }
+}
 
-    if (!myflags->set) {
-        /* the data is not to be tagged - just copy it
-         * and move on to processing
-         */
-        output->data = (char*)malloc(bo->size);
-        memcpy(output->data, bo->bytes, bo->size);
-        output->numbytes = bo->size;
-        goto process;
-    }
+static const char *iof_tag_suffix[PMIX_IOF_TAG_STREAMS] = {"stdout", "stderr", "stddiag"};
 
-    /* if this is to be xml tagged, create a tag with the correct syntax - we do not allow
-     * timestamping of xml output
-     */
-    if (myflags->xml) {
-        if (myflags->tag) {
-            /* find the '@' delimiter in the nspace */
-            cptr = strrchr(name->nspace, '@');
-            if (NULL == cptr) {
-                usestring = name->nspace;  // just use the whole thing
-            } else {
-                ++cptr;
-                usestring = cptr; // use the jobid portion
-            }
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                          "<%s %s=\"%s\" rank=\"%s\"", suffix,
-                          (usestring == name->nspace) ? "nspace" : "jobid",
-                          usestring, PMIX_RANK_PRINT(name->rank));
-        } else if (myflags->tag_fullname) {
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                          "<%s nspace=\"%s\" rank=\"%s\"", suffix,
-                          name->nspace, PMIX_RANK_PRINT(name->rank));
-        } else if (myflags->tag_detailed) {
-            /* we need the hostname and pid of the source */
-            PMIX_CONSTRUCT(&cb2, pmix_cb_t);
-            cb2.proc = (pmix_proc_t*)name;
-            cb2.key = PMIX_HOSTNAME;
-            cb2.info = &optional;
-            cb2.ninfo = 1;
-            PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
-            if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
-                kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
-                if (NULL != kv) {  // should never be NULL
-                    cptr = strdup(kv->value->data.string);
-                    PMIX_RELEASE(kv);
-                } else {
-                    cptr = strdup("unknown");
-                }
-            } else {
-                cptr = strdup("unknown");
-            }
-            PMIX_DESTRUCT(&cb2);
-            /* get the pid */
-            PMIX_CONSTRUCT(&cb2, pmix_cb_t);
-            cb2.proc = (pmix_proc_t*)name;
-            cb2.key = PMIX_PROC_PID;
-            cb2.info = &optional;
-            cb2.ninfo = 1;
-            PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
-            if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
-                kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
-                if (NULL != kv) { // should never be NULL
-                    PMIX_VALUE_GET_NUMBER(rc, kv->value, pid, pid_t);
-                    PMIX_RELEASE(kv);
-                    if (PMIX_SUCCESS != rc) {
-                        pidstring = strdup("unknown");
-                    } else {
-                        pmix_asprintf(&pidstring, "%u", pid);
-                    }
-                } else {
-                    pidstring = strdup("unknown");
-                }
-            } else {
-                pidstring = strdup("unknown");
-            }
-            PMIX_DESTRUCT(&cb2);
-
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                          "<%s nspace=\"%s\" rank=\"%s\"[\"%s\":\"%s\"",
-                          suffix, name->nspace,
-                          PMIX_RANK_PRINT(name->rank),
-                          cptr, pidstring);
-            free(cptr);
-            free(pidstring);
-        } else if (myflags->rank) {
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                     "<%s rank=\"%s\"", suffix,
-                     PMIX_RANK_PRINT(name->rank));
-        } else if (myflags->timestamp) {
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                     "<%s rank=\"%s\"", suffix,
-                     PMIX_RANK_PRINT(name->rank));
-        } else {
-            pmix_snprintf(begintag, PMIX_IOF_BASE_TAG_MAX,
-                     "<%s rank=\"%s\"", suffix,
-                     PMIX_RANK_PRINT(name->rank));
-        }
-        pmix_snprintf(endtag, PMIX_IOF_BASE_TAG_MAX,
-                 "</%s>", suffix);
+/* (re)build the tags for a source to match the given flags */
+static void iof_build_tags(const pmix_proc_t *name, pmix_iof_flags_t *myflags,
+                           pmix_iof_tag_t *tags)
+{
+    pmix_iof_tag_stream_t *ts;
+    const char *suffix, *usestring, *jobid;
+    char *cptr;
+    int n;
+
+    tags->xml = myflags->xml;
+    tags->tag = myflags->tag;
+    tags->tag_detailed = myflags->tag_detailed;
+    tags->tag_fullname = myflags->tag_fullname;
+    tags->rank = myflags->rank;
+
+    if (myflags->tag_detailed && NULL == tags->hostname) {
+        /* these cannot change, so keep them across rebuilds */
+        iof_fetch_source(name, &tags->hostname, &tags->pid);
+    }
+
+    /* find the '@' delimiter in the nspace */
+    cptr = strrchr(name->nspace, '@');
+    if (NULL == cptr) {
+        jobid = name->nspace;  // just use the whole thing
     } else {
-        if (myflags->tag) {
-            /* find the '@' delimiter in the nspace */
-            cptr = strrchr(name->nspace, '@');
-            if (NULL == cptr) {
-                usestring = name->nspace;  // just use the whole thing
-            } else {
-                ++cptr;
-                usestring = cptr; // use the jobid portion
-            }
-            pmix_snprintf(outtag, PMIX_IOF_BASE_TAG_MAX,
-                          "[%s,%s]<%s>: ",
-                          usestring,
-                          PMIX_RANK_PRINT(name->rank),
-                          suffix);
-        } else if (myflags->tag_detailed) {
-            if (myflags->tag_fullname) {
-                usestring = name->nspace;
+        jobid = cptr + 1; // use the jobid portion
+    }
+
+    for (n = 0; n < PMIX_IOF_TAG_STREAMS; n++) {
+        ts = &tags->streams[n];
+        suffix = iof_tag_suffix[n];
+        if (NULL != ts->lead) {
+            free(ts->lead);
+            free(ts->tail);
+            free(ts->end);
+        }
+        /* we do not allow timestamping of xml output, so the timestamp
+         * only ever goes inside the starttag */
+        if (myflags->xml) {
+            if (myflags->tag) {
+                pmix_asprintf(&ts->lead, "<%s %s=\"%s\" rank=\"%s\"", suffix,
+                              (jobid == name->nspace) ? "nspace" : "jobid",
+                              jobid, PMIX_RANK_PRINT(name->rank));
+            } else if (myflags->tag_fullname) {
+                pmix_asprintf(&ts->lead, "<%s nspace=\"%s\" rank=\"%s\"", suffix,
+                              name->nspace, PMIX_RANK_PRINT(name->rank));
+            } else if (myflags->tag_detailed) {
+                pmix_asprintf(&ts->lead, "<%s nspace=\"%s\" rank=\"%s\"[\"%s\":\"%s\"",
+                              suffix, name->nspace, PMIX_RANK_PRINT(name->rank),
+                              tags->hostname, tags->pid);
             } else {
-                /* find the '@' delimiter in the nspace */
-                cptr = strrchr(name->nspace, '@');
-                if (NULL == cptr) {
-                    usestring = name->nspace;  // just use the whole thing
-                } else {
-                    ++cptr;
-                    usestring = cptr; // use the jobid portion
-                }
-            }
-            /* we need the hostname and pid of the source */
-            PMIX_CONSTRUCT(&cb2, pmix_cb_t);
-            cb2.proc = (pmix_proc_t*)name;
-            cb2.key = PMIX_HOSTNAME;
-            cb2.info = &optional;
-            cb2.ninfo = 1;
-            PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
-            if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
-                kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
-                cptr = strdup(kv->value->data.string);
-                PMIX_RELEASE(kv);
-            } else {
-                cptr = strdup("unknown");
+                pmix_asprintf(&ts->lead, "<%s rank=\"%s\"", suffix,
+                              PMIX_RANK_PRINT(name->rank));
             }
-            PMIX_DESTRUCT(&cb2);
-            /* get the pid */
-            PMIX_CONSTRUCT(&cb2, pmix_cb_t);
-            cb2.proc = (pmix_proc_t*)name;
-            cb2.key = PMIX_PROC_PID;
-            cb2.info = &optional;
-            cb2.ninfo = 1;
-            PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb2);
-            if (PMIX_SUCCESS == rc || PMIX_OPERATION_SUCCEEDED == rc) {
-                kv = (pmix_kval_t*)pmix_list_remove_first(&cb2.kvs);
-                PMIX_VALUE_GET_NUMBER(rc, kv->value, pid, pid_t);
-                PMIX_RELEASE(kv);
-                if (PMIX_SUCCESS != rc) {
-                    pidstring = strdup("unknown");
-                } else {
-                    pmix_asprintf(&pidstring, "%u", pid);
-                }
+            ts->tail = strdup(">");
+            pmix_asprintf(&ts->end, "</%s>\n", suffix);
+        } else {
+            ts->lead = strdup("");
+            if (myflags->tag) {
+                pmix_asprintf(&ts->tail, "[%s,%s]<%s>: ", jobid,
+                              PMIX_RANK_PRINT(name->rank), suffix);
+            } else if (myflags->tag_detailed) {
+                usestring = myflags->tag_fullname ? name->nspace : jobid;
+                pmix_asprintf(&ts->tail, "[%s,%s][%s:%s]<%s>: ", usestring,
+                              PMIX_RANK_PRINT(name->rank), tags->hostname,
+                              tags->pid, suffix);
+            } else if (myflags->tag_fullname) {
+                pmix_asprintf(&ts->tail, "[%s,%s]<%s>: ", name->nspace,
+                              PMIX_RANK_PRINT(name->rank), suffix);
+            } else if (myflags->rank) {
+                pmix_asprintf(&ts->tail, "[%s]<%s>: ",
+                              PMIX_RANK_PRINT(name->rank), suffix);
             } else {
-                pidstring = strdup("unknown");
+                ts->tail = strdup("");
             }
-            PMIX_DESTRUCT(&cb2);
-            pmix_snprintf(outtag, PMIX_IOF_BASE_TAG_MAX,
-                          "[%s,%s][%s:%s]<%s>: ",
-                          usestring,
-                          PMIX_RANK_PRINT(name->rank),
-                          cptr, pidstring,
-                          suffix);
-            free(cptr);
-            free(pidstring);
-        } else if (myflags->tag_fullname) {
-            pmix_snprintf(outtag, PMIX_IOF_BASE_TAG_MAX,
-                          "[%s,%s]<%s>: ",
-                          name->nspace,
-                          PMIX_RANK_PRINT(name->rank),
-                          suffix);
-        } else if (myflags->rank) {
-            pmix_snprintf(outtag, PMIX_IOF_BASE_TAG_MAX,
-                     "[%s]<%s>: ",
-                     PMIX_RANK_PRINT(name->rank), suffix);
+            ts->end = strdup("");
         }
+        ts->nlead = strlen(ts->lead);
+        ts->ntail = strlen(ts->tail);
+        ts->nend = strlen(ts->end);
     }
+}
 
-    /* if we are to timestamp output, start the tag with that */
-    if (myflags->timestamp) {
-        time_t mytime;
-        /* get the timestamp */
-        time(&mytime);
-        cptr = ctime(&mytime);
-        cptr[strlen(cptr) - 1] = '\0'; /* remove trailing newline */
-
-        if (myflags->xml && !myflags->tag && !myflags->rank) {
-            pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX,
-                     " timestamp=\"%s\"", cptr);
-        } else if (myflags->xml && (myflags->tag || myflags->rank)) {
-            pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX,
-                     " timestamp=\"%s\"", cptr);
-        } else if (myflags->tag || myflags->rank) {
-            pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX, "[%s]", cptr);
-        } else {
-            pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX, "[%s]<%s>: ", cptr, suffix);
-        }
-    }
+/* return the tags for a source, building them if this is its first
+ * output or if the flags have changed since they were built. The
+ * caller must release the returned object */
+static pmix_iof_tag_t *iof_get_tags(const pmix_proc_t *name, pmix_namespace_t *nptr,
+                                    pmix_iof_flags_t *myflags)
+{
+    pmix_iof_tag_t *tags = NULL;
 
-    /* start with the starttag */
-    if (0 < strlen(begintag)) {
-        pmix_argv_append_nosize(&segments, begintag);
+    if (NULL != nptr && PMIX_RANK_IS_VALID(name->rank)) {
+        tags = (pmix_iof_tag_t *) pmix_pointer_array_get_item(&nptr->iof_tags, name->rank);
     }
-    /* add the timestamp */
-    if (0 < strlen(timestamp)) {
-        pmix_argv_append_nosize(&segments, timestamp);
+    if (NULL == tags) {
+        tags = PMIX_NEW(pmix_iof_tag_t);
+        iof_build_tags(name, myflags, tags);
+        if (NULL != nptr && PMIX_RANK_IS_VALID(name->rank)
+            && PMIX_SUCCESS == pmix_pointer_array_set_item(&nptr->iof_tags, name->rank, tags)) {
+            PMIX_RETAIN(tags);
+        }
+        return tags;
     }
-    /* add the output tag */
-    if (0 < strlen(outtag)) {
-        pmix_argv_append_nosize(&segments, outtag);
+    if (tags->xml != myflags->xml || tags->tag != myflags->tag
+        || tags->tag_detailed != myflags->tag_detailed
+        || tags->tag_fullname != myflags->tag_fullname || tags->rank != myflags->rank) {
+        iof_build_tags(name, myflags, tags);
     }
-    /* if xml, end the starttag with a '>' */
-    if (myflags->xml) {
-        pmix_argv_append_nosize(&segments, ">");
+    PMIX_RETAIN(tags);
+    return tags;
+}
+
+/* print the timestamp for a line into the given buffer, returning
+ * its length - the time string is only regenerated once a second */
+static size_t iof_timestamp(pmix_iof_flags_t *myflags, const char *suffix, char *timestamp)
+{
+    static time_t last = 0;
+    static char stamp[64];
+    time_t mytime;
+
+    time(&mytime);
+    if (mytime != last) {
+        pmix_snprintf(stamp, sizeof(stamp), "%s", ctime(&mytime));
+        stamp[strlen(stamp) - 1] = '\0'; /* remove trailing newline */
+        last = mytime;
     }
 
-    /* if we are doing XML, then we need to replace key characters */
     if (myflags->xml) {
-        bufsize = bo->size;
-        for (n = 0; n < bo->size; n++) {
-            if ('&' == bo->bytes[n]) {
-                bufsize += 5;
-            } else if ('<' == bo->bytes[n] || '>' == bo->bytes[n]) {
-                bufsize += 4;
-            } else if (!isprint(bo->bytes[n])) {
-                pmix_snprintf(qprint, 10, "&#%03d;", (int) bo->bytes[n]);
-                bufsize += strlen(qprint);
+        pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX, " timestamp=\"%s\"", stamp);
+    } else if (myflags->tag || myflags->rank) {
+        pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX, "[%s]", stamp);
+    } else {
+        pmix_snprintf(timestamp, PMIX_IOF_BASE_TAG_MAX, "[%s]<%s>: ", stamp, suffix);
+    }
+    return strlen(timestamp);
+}
+
+/* reserve room for nbytes at the end of the output queued on
+ * a channel, appending to the last buffer if it has not yet been
+ * written and is not too large. Returns a pointer to the reserved
+ * space, or NULL if it could not be allocated */
+static char *iof_output_reserve(pmix_iof_write_event_t *channel, size_t nbytes)
+{
+    pmix_iof_write_output_t *output;
+    pmix_list_item_t *item;
+    size_t need, size;
+    char *data;
+    bool fresh = false;
+
+    item = pmix_list_get_last(&channel->outputs);
+    output = (pmix_iof_write_output_t *) item;
+    if (pmix_list_get_end(&channel->outputs) == item || 0 == output->numbytes
+        || PMIX_IOF_MAX_COALESCE < (size_t) output->numbytes + nbytes) {
+        output = PMIX_NEW(pmix_iof_write_output_t);
+        fresh = true;
+    }
+
+    need = (size_t) output->numbytes + nbytes;
+    if (output->size < need) {
+        size = (0 == output->size) ? PMIX_IOF_SINK_BLOCKSIZE : 2 * output->size;
+        if (size < need) {
+            size = need;
+        }
+        data = (char *) realloc(output->data, size);
+        if (NULL == data) {
+            if (fresh) {
+                PMIX_RELEASE(output);
             }
+            return NULL;
         }
-        if (bo->size < bufsize) {
-            /* we need to increase the size of our buffer to handle the
-             * extra characters we need to add to represent these special
-             * cases */
-            buffer = malloc(bufsize);
-            memset(buffer, 0, bufsize);
-            bufcopy = true;
-            m = 0;
-            for (n = 0; n < bo->size; n++) {
-                if ('&' == bo->bytes[n]) {
-                    buffer[m++] = '&';
-                    buffer[m++] = 'a';
-                    buffer[m++] = 'p';
-                    buffer[m++] = ';';
-                } else if ('<' == bo->bytes[n]) {
-                    buffer[m++] = '&';
-                    buffer[m++] = 'l';
-                    buffer[m++] = 't';
-                    buffer[m++] = ';';
-                } else if ('>' == bo->bytes[n]) {
-                    buffer[m++] = '&';
-                    buffer[m++] = 'g';
-                    buffer[m++] = 't';
-                    buffer[m++] = ';';
-                } else if (!isprint(bo->bytes[n])) {
-                    pmix_snprintf(qprint, 10, "&#%03d;", (int) bo->bytes[n]);
-                    for (j = 0; j < strlen(qprint); j++) {
-                        buffer[m++] = qprint[j];
-                    }
-                } else {
-                    buffer[m++] = bo->bytes[n];
-                }
-            }
+        output->data = data;
+        output->size = size;
+    }
+    if (fresh) {
+        pmix_list_append(&channel->outputs, &output->super);
+    }
+    data = &output->data[output->numbytes];
+    output->numbytes += nbytes;
+    return data;
+}
+
+/* copy an escaped version of the data into the given buffer, or just
+ * compute the space required if the buffer is NULL */
+static size_t iof_xml_escape(const pmix_byte_object_t *bo, char *buffer)
+{
+    char qprint[15];
+    const char *esc;
+    size_t n, m = 0, len;
+
+    for (n = 0; n < bo->size; n++) {
+        if ('&' == bo->bytes[n]) {
+            esc = "&amp;";
+        } else if ('<' == bo->bytes[n]) {
+            esc = "&lt;";
+        } else if ('>' == bo->bytes[n]) {
+            esc = "&gt;";
+        } else if (!isprint(bo->bytes[n])) {
+            pmix_snprintf(qprint, 10, "&#%03d;", (int) bo->bytes[n]);
+            esc = qprint;
         } else {
-            buffer = bo->bytes;
-            bufsize = bo->size;
-            bufcopy = false;
+            if (NULL != buffer) {
+                buffer[m] = bo->bytes[n];
+            }
+            ++m;
+            continue;
         }
-    } else {
-        buffer = bo->bytes;
-        bufsize = bo->size;
-        bufcopy = false;
+        len = strlen(esc);
+        if (NULL != buffer) {
+            memcpy(&buffer[m], esc, len);
+        }
+        m += len;
     }
+    return m;
+}
 
-    /* assemble the output line */
-    if (NULL != segments) {
-        for (n=0; NULL != segments[n]; n++) {
-            output->numbytes += strlen(segments[n]);
-        }
+static pmix_status_t write_output_line(const pmix_proc_t *name,
+                                       pmix_iof_write_event_t *channel,
+                                       pmix_iof_flags_t *myflags,
+                                       pmix_iof_tag_t *tags,
+                                       pmix_iof_channel_t stream,
+                                       bool copystdout, bool copystderr,
+                                       const pmix_byte_object_t *bo)
+{
+    char timestamp[PMIX_IOF_BASE_TAG_MAX];
+    pmix_iof_write_output_t *output;
+    pmix_iof_tag_stream_t *ts;
+    pmix_iof_tag_t *mytags = NULL;
+    size_t nts = 0, ndata, len;
+    char *data, *cptr;
+    int idx;
+
+    /* if 0 bytes, then just pass it so the fd can be closed
+     * after it writes everything out - this must be its own
+     * output so it is seen by the write handler
+     */
+    if (0 == bo->size) {
+        output = PMIX_NEW(pmix_iof_write_output_t);
+        pmix_list_append(&channel->outputs, &output->super);
+        goto process;
     }
-    output->numbytes += bufsize;
-    output->numbytes += strlen(endtag);
-    if (myflags->xml) {
-        // add a spot for a trailing newline
-        output->numbytes++;
+
+    /* write output data to the corresponding tag */
+    if (PMIX_FWD_STDIN_CHANNEL & stream) {
+        /* stdin is never tagged */
+        idx = -1;
+    } else if (PMIX_FWD_STDOUT_CHANNEL & stream) {
+        idx = 0;
+    } else if (PMIX_FWD_STDERR_CHANNEL & stream) {
+        idx = 1;
+    } else if (PMIX_FWD_STDDIAG_CHANNEL & stream) {
+        idx = 2;
+    } else {
+        /* error - this should never happen */
+        PMIX_ERROR_LOG(PMIX_ERR_VALUE_OUT_OF_BOUNDS);
+        PMIX_OUTPUT_VERBOSE((1, pmix_client_globals.iof_output, "%s stream %0x",
+                             PMIX_NAME_PRINT(&pmix_globals.myid), stream));
+        return PMIX_ERR_VALUE_OUT_OF_BOUNDS;
     }
 
-    output->data = (char*)malloc(output->numbytes);
-    offset = 0;
-    if (NULL != segments) {
-        for (n=0; NULL != segments[n]; n++) {
-            memcpy(&output->data[offset], segments[n], strlen(segments[n]));
-            offset += strlen(segments[n]);
+    if (0 > idx || !myflags->set) {
+        /* the data is not to be tagged - just copy it
+         * and move on to processing
+         */
+        data = iof_output_reserve(channel, bo->size);
+        if (NULL == data) {
+            return PMIX_ERR_NOMEM;
         }
+        memcpy(data, bo->bytes, bo->size);
+        len = bo->size;
+        goto copy;
     }
-    memcpy(&output->data[offset], buffer, bufsize);
-    offset += bufsize;
-    if (0 < strlen(endtag)) {
-        memcpy(&output->data[offset], endtag, strlen(endtag));
-    }
-    if (myflags->xml) {
-        output->data[output->numbytes-1] = '\n';
+
+    if (NULL == tags) {
+        tags = mytags = PMIX_NEW(pmix_iof_tag_t);
+        iof_build_tags(name, myflags, tags);
     }
-    if (bufcopy) {
-        free(buffer);
+    ts = &tags->streams[idx];
+
+    /* if we are to timestamp output, start the tag with that */
+    if (myflags->timestamp) {
+        nts = iof_timestamp(myflags, iof_tag_suffix[idx], timestamp);
     }
 
-process:
-    /* add this data to the write list for this fd */
-    pmix_list_append(&channel->outputs, &output->super);
+    /* if we are doing XML, then we need to replace key characters */
+    if (myflags->xml) {
+        ndata = iof_xml_escape(bo, NULL);
+    } else {
+        ndata = bo->size;
+    }
 
-    if (copystdout){
-        copy = PMIX_NEW(pmix_iof_write_output_t);
-        copy->data = (char *) malloc(output->numbytes);
-        memcpy(copy->data, output->data, output->numbytes);
-        copy->numbytes = output->numbytes;
-        pmix_list_append(&pmix_client_globals.iof_stdout.wev.outputs, &copy->super);
-        if (!pmix_client_globals.iof_stdout.wev.pending) {
-            PMIX_IOF_SINK_ACTIVATE(&pmix_client_globals.iof_stdout.wev);
+    /* assemble the output line directly into the channel's output */
+    len = ts->nlead + nts + ts->ntail + ndata + ts->nend;
+    data = iof_output_reserve(channel, len);
+    if (NULL == data) {
+        if (NULL != mytags) {
+            PMIX_RELEASE(mytags);
         }
+        return PMIX_ERR_NOMEM;
     }
-    if (copystderr){
-        copy = PMIX_NEW(pmix_iof_write_output_t);
-        copy->data = (char *) malloc(output->numbytes);
-        memcpy(copy->data, output->data, output->numbytes);
-        copy->numbytes = output->numbytes;
-        pmix_list_append(&pmix_client_globals.iof_stderr.wev.outputs, &copy->super);
-        if (!pmix_client_globals.iof_stderr.wev.pending) {
-            PMIX_IOF_SINK_ACTIVATE(&pmix_client_globals.iof_stderr.wev);
+    cptr = data;
+    memcpy(cptr, ts->lead, ts->nlead);
+    cptr += ts->nlead;
+    memcpy(cptr, timestamp, nts);
+    cptr += nts;
+    memcpy(cptr, ts->tail, ts->ntail);
+    cptr += ts->ntail;
+    if (myflags->xml) {
+        iof_xml_escape(bo, cptr);
+    } else {
+        memcpy(cptr, bo->bytes, ndata);
+    }
+    cptr += ndata;
+    memcpy(cptr, ts->end, ts->nend);
+    if (NULL != mytags) {
+        PMIX_RELEASE(mytags);
+    }
+
+copy:
+    /* the copies cannot go to the channel itself as reserving
+     * space there could move the data we are copying */
+    if (copystdout && channel != &pmix_client_globals.iof_stdout.wev) {
+        cptr = iof_output_reserve(&pmix_client_globals.iof_stdout.wev, len);
+        if (NULL != cptr) {
+            memcpy(cptr, data, len);
+            if (!pmix_client_globals.iof_stdout.wev.pending) {
+                PMIX_IOF_SINK_ACTIVATE(&pmix_client_globals.iof_stdout.wev);
+            }
+        }
+    }
+    if (copystderr && channel != &pmix_client_globals.iof_stderr.wev) {
+        cptr = iof_output_reserve(&pmix_client_globals.iof_stderr.wev, len);
+        if (NULL != cptr) {
+            memcpy(cptr, data, len);
+            if (!pmix_client_globals.iof_stderr.wev.pending) {
+                PMIX_IOF_SINK_ACTIVATE(&pmix_client_globals.iof_stderr.wev);
+            }
         }
     }
 
+process:
     /* is the write event issued? */
     if (!channel->pending) {
         /* issue it */
@@ -1481,12 +1474,14 @@ process:
 pmix_status_t pmix_iof_write_output(const pmix_proc_t *name, pmix_iof_channel_t stream,
                                     const pmix_byte_object_t *bo)
 {
-    pmix_status_t rc;
-    size_t n, start;
+    pmix_status_t rc = PMIX_SUCCESS;
+    size_t start;
     pmix_byte_object_t bopass;
+    pmix_iof_tag_t *tags = NULL;
+    char *eol;
     pmix_iof_write_event_t *channel;
     pmix_iof_flags_t myflags;
-    pmix_namespace_t *nptr, *ns;
+    pmix_namespace_t *nptr;
     bool outputio;
     bool copystdout = false;
     bool copystderr = false;
@@ -1502,14 +1497,7 @@ pmix_status_t pmix_iof_write_output(const pmix_proc_t *name, pmix_iof_channel_t
     }
 
     /* find the nspace for this source */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t)
-    {
-        if (0 == strcmp(ns->nspace, name->nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(name->nspace);
 
     channel = NULL;
     /* default outputio to our flag */
@@ -1605,11 +1593,16 @@ pmix_status_t pmix_iof_write_output(const pmix_proc_t *name, pmix_iof_channel_t
 
     /* zero bytes can just be passed along */
     if (0 == bo->size) {
-        rc = write_output_line(name, channel, &myflags, stream,
+        rc = write_output_line(name, channel, &myflags, NULL, stream,
                                false, false, bo);
         return rc;
     }
 
+    /* get the tags for this source once for all its lines */
+    if (myflags.set) {
+        tags = iof_get_tags(name, nptr, &myflags);
+    }
+
     /* see if we have some residual for this name/stream */
     inputdata = bo->bytes;
     inputsize = bo->size;
@@ -1631,34 +1624,24 @@ pmix_status_t pmix_iof_write_output(const pmix_proc_t *name, pmix_iof_channel_t
 
     /* search the input data stream for '\n' */
     start = 0;
-    for (n=0; n < inputsize; n++) {
-        if ('\n' == inputdata[n]) {
-            bopass.bytes = &inputdata[start];
-            bopass.size = n - start + 1;
-            rc = write_output_line(name, channel, &myflags, stream,
-                                   copystdout, copystderr, &bopass);
-            if (PMIX_SUCCESS != rc) {
-                if (copied) {
-                    free(inputdata);
-                }
-                return rc;
-            }
-            start = n + 1;
+    while (start < inputsize
+           && NULL != (eol = memchr(&inputdata[start], '\n', inputsize - start))) {
+        bopass.bytes = &inputdata[start];
+        bopass.size = eol - bopass.bytes + 1;
+        rc = write_output_line(name, channel, &myflags, tags, stream,
+                               copystdout, copystderr, &bopass);
+        if (PMIX_SUCCESS != rc) {
+            goto cleanup;
         }
+        start += bopass.size;
     }
 
     if (start < inputsize) {
         if (myflags.raw) {
             bopass.bytes = &inputdata[start];
             bopass.size = inputsize - start;
-            rc = write_output_line(name, channel, &myflags, stream,
+            rc = write_output_line(name, channel, &myflags, tags, stream,
                                    copystdout, copystderr, &bopass);
-            if (PMIX_SUCCESS != rc) {
-                if (copied) {
-                    free(inputdata);
-                }
-                return rc;
-            }
         } else {
             /* we have some residual that needs to be cached until
              * the rest of the line is seen */
@@ -1675,10 +1658,15 @@ pmix_status_t pmix_iof_write_output(const pmix_proc_t *name, pmix_iof_channel_t
             pmix_list_append(&pmix_server_globals.iof_residuals, &res->super);
         }
     }
+
+cleanup:
+    if (NULL != tags) {
+        PMIX_RELEASE(tags);
+    }
     if (copied) {
         free(inputdata);
     }
-    return PMIX_SUCCESS;
+    return rc;
 }
 
 void pmix_iof_flush_residuals(void)
@@ -1687,7 +1675,7 @@ void pmix_iof_flush_residuals(void)
     pmix_iof_residual_t *res;
 
     PMIX_LIST_FOREACH(res, &pmix_server_globals.iof_residuals, pmix_iof_residual_t) {
-        rc = write_output_line(&res->name, res->channel, &res->flags,
+        rc = write_output_line(&res->name, res->channel, &res->flags, NULL,
                                res->stream, res->copystdout, res->copystderr, &res->bo);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
@@ -1886,11 +1874,91 @@ static void opcbfn(pmix_status_t status, void *cbdata)
     PMIX_BYTE_OBJECT_FREE(boptr, 1);
 }
 
+#ifdef HAVE_SPLICE
+/* if the output of a child goes untagged to a file sink that has
+ * nothing queued for it, move the bytes from the pipe straight into
+ * the file without copying them through user space. Returns true
+ * if the data was handled */
+static bool iof_splice_child(pmix_iof_read_event_t *rev, pmix_pfexec_child_t *child,
+                             int fd, size_t avail)
+{
+    pmix_namespace_t *nptr;
+    pmix_iof_flags_t *flags;
+    pmix_iof_sink_t *sink, *target = NULL;
+    pmix_iof_residual_t *res;
+    bool outputio;
+    ssize_t rc;
+
+    if (rev->nosplice) {
+        return false;
+    }
+    nptr = pmix_nspace_lookup(child->proc.nspace);
+    if (NULL == nptr || !nptr->iof_flags.set) {
+        return false;
+    }
+    flags = &nptr->iof_flags;
+    if (NULL == flags->file && NULL == flags->directory) {
+        return false;
+    }
+    outputio = flags->local_output_given ? flags->local_output
+                                         : pmix_globals.iof_flags.local_output;
+    if (!outputio) {
+        return false;
+    }
+    if (flags->xml || flags->tag || flags->tag_detailed || flags->tag_fullname
+        || flags->rank || flags->timestamp) {
+        return false;
+    }
+    /* copies to our own stdout/stderr are queued behind other
+     * output, and merged streams must be kept whole lines */
+    if ((!flags->nocopy && pmix_globals.iof_flags.local_output)
+        || (flags->merge && !flags->raw)) {
+        return false;
+    }
+    PMIX_LIST_FOREACH(sink, &nptr->sinks, pmix_iof_sink_t) {
+        if (sink->name.rank == child->proc.rank &&
+            ((rev->channel & sink->tag) || flags->merge)) {
+            target = sink;
+            break;
+        }
+    }
+    /* the first output sets up the sink on the regular path */
+    if (NULL == target || 0 > target->wev.fd || !pmix_list_is_empty(&target->wev.outputs)) {
+        return false;
+    }
+    /* any partial line must be written first */
+    PMIX_LIST_FOREACH(res, &pmix_server_globals.iof_residuals, pmix_iof_residual_t) {
+        if (PMIX_CHECK_PROCID(&child->proc, &res->name) && (rev->channel & res->stream)) {
+            return false;
+        }
+    }
+
+    rc = splice(fd, NULL, target->wev.fd, NULL, avail, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (0 > rc && EAGAIN != errno && EINTR != errno) {
+        /* not supported for these fds - use the regular path */
+        PMIX_OUTPUT_VERBOSE((1, pmix_client_globals.iof_output,
+                             "%s iof:read splice to fd %d failed: %s",
+                             PMIX_NAME_PRINT(&pmix_globals.myid), target->wev.fd,
+                             strerror(errno)));
+        rev->nosplice = true;
+        return false;
+    }
+    if (0 == rc) {
+        /* let the regular path see the EOF */
+        return false;
+    }
+    rev->active = false;
+    PMIX_IOF_READ_ACTIVATE(rev);
+    return true;
+}
+#endif
+
 /* this is the read handler for stdin */
 void pmix_iof_read_local_handler(int sd, short args, void *cbdata)
 {
     pmix_iof_read_event_t *rev = (pmix_iof_read_event_t *) cbdata;
-    unsigned char data[PMIX_IOF_BASE_MSG_MAX];
+    char *data;
+    size_t avail = PMIX_IOF_BASE_MSG_MAX;
     int32_t numbytes;
     pmix_status_t rc;
     pmix_buffer_t *msg;
@@ -1907,9 +1975,38 @@ void pmix_iof_read_local_handler(int sd, short args, void *cbdata)
     } else {
         fd = rev->fd;
     }
-    /* read up to the fragment size */
-    memset(data, 0, PMIX_IOF_BASE_MSG_MAX);
-    numbytes = read(fd, data, sizeof(data));
+#ifdef FIONREAD
+    {
+        int navail;
+
+        /* size the read to what is waiting for us */
+        if (0 == ioctl(fd, FIONREAD, &navail) && PMIX_IOF_BASE_MSG_MAX < navail) {
+            avail = (PMIX_IOF_MAX_READ < navail) ? PMIX_IOF_MAX_READ : (size_t) navail;
+        }
+    }
+#endif
+
+#ifdef HAVE_SPLICE
+    if (NULL != child &&
+        (PMIX_FWD_STDOUT_CHANNEL == rev->channel ||
+         PMIX_FWD_STDERR_CHANNEL == rev->channel) &&
+        iof_splice_child(rev, child, fd, avail)) {
+        return;
+    }
+#endif
+
+    if (rev->datasize < avail) {
+        data = (char *) realloc(rev->data, avail);
+        if (NULL != data) {
+            rev->data = data;
+            rev->datasize = avail;
+        } else if (NULL == rev->data) {
+            PMIX_ERROR_LOG(PMIX_ERR_NOMEM);
+            rev->active = false;
+            return;
+        }
+    }
+    numbytes = read(fd, rev->data, rev->datasize);
 
     /* The event has fired, so it's no longer active until we
      re-add it */
@@ -1933,7 +2030,7 @@ void pmix_iof_read_local_handler(int sd, short args, void *cbdata)
         bo.size = 0;
         numbytes = 0;
     } else {
-        bo.bytes = (char *) data;
+        bo.bytes = rev->data;
         bo.size = numbytes;
     }
 
@@ -1973,7 +2070,7 @@ void pmix_iof_read_local_handler(int sd, short args, void *cbdata)
             PMIX_LIST_FOREACH(child, &pmix_pfexec_globals.children, pmix_pfexec_child_t) {
                 if (PMIX_CHECK_PROCID(&child->proc, &rev->targets[0])) {
                     /* send the input to that target */
-                    rc = write_output_line(&child->proc, &child->stdinsink.wev, NULL,
+                    rc = write_output_line(&child->proc, &child->stdinsink.wev, NULL, NULL,
                                            PMIX_FWD_STDIN_CHANNEL, false, false, &bo);
                     goto reactivate;
                 }
@@ -2111,6 +2208,9 @@ static void iof_read_event_construct(pmix_iof_read_event_t *rev)
     rev->ntargets = 0;
     rev->directives = NULL;
     rev->ndirs = 0;
+    rev->data = NULL;
+    rev->datasize = 0;
+    rev->nosplice = false;
 }
 static void iof_read_event_destruct(pmix_iof_read_event_t *rev)
 {
@@ -2129,6 +2229,9 @@ static void iof_read_event_destruct(pmix_iof_read_event_t *rev)
     if (NULL != rev->directives) {
         PMIX_INFO_FREE(rev->directives, rev->ndirs);
     }
+    if (NULL != rev->data) {
+        free(rev->data);
+    }
 }
 PMIX_CLASS_INSTANCE(pmix_iof_read_event_t, pmix_object_t, iof_read_event_construct,
                     iof_read_event_destruct);
@@ -2165,6 +2268,7 @@ static void wocon(pmix_iof_write_output_t *p)
 {
     p->data = NULL;
     p->numbytes = 0;
+    p->size = 0;
 }
 static void wodes(pmix_iof_write_output_t *p)
 {
@@ -2176,6 +2280,43 @@ PMIX_CLASS_INSTANCE(pmix_iof_write_output_t,
                     pmix_list_item_t,
                     wocon, wodes);
 
+static void iotcon(pmix_iof_tag_t *p)
+{
+    p->xml = false;
+    p->tag = false;
+    p->tag_detailed = false;
+    p->tag_fullname = false;
+    p->rank = false;
+    p->hostname = NULL;
+    p->pid = NULL;
+    memset(p->streams, 0, sizeof(p->streams));
+}
+static void iotdes(pmix_iof_tag_t *p)
+{
+    int n;
+
+    if (NULL != p->hostname) {
+        free(p->hostname);
+    }
+    if (NULL != p->pid) {
+        free(p->pid);
+    }
+    for (n = 0; n < PMIX_IOF_TAG_STREAMS; n++) {
+        if (NULL != p->streams[n].lead) {
+            free(p->streams[n].lead);
+        }
+        if (NULL != p->streams[n].tail) {
+            free(p->streams[n].tail);
+        }
+        if (NULL != p->streams[n].end) {
+            free(p->streams[n].end);
+        }
+    }
+}
+PMIX_CLASS_INSTANCE(pmix_iof_tag_t,
+                    pmix_object_t,
+                    iotcon, iotdes);
+
 static void iofrescon(pmix_iof_residual_t *p)
 {
     PMIX_BYTE_OBJECT_CONSTRUCT(&p->bo);
@@ -62,6 +62,10 @@ BEGIN_C_DECLS
 #define PMIX_IOF_BASE_TAG_MAX        1024
 #define PMIX_IOF_MAX_INPUT_BUFFERS   50
 #define PMIX_IOF_MAX_RETRIES         4
+/* max bytes read from a source in one pass when more is available */
+#define PMIX_IOF_MAX_READ            (1024 * 1024)
+/* max bytes gathered into one output before starting another */
+#define PMIX_IOF_MAX_COALESCE        (64 * 1024)
 
 typedef struct {
     pmix_list_item_t super;
@@ -111,9 +115,39 @@ typedef struct {
     pmix_list_item_t super;
     char *data;
     int numbytes;
+    size_t size; // bytes allocated for data, if more than numbytes
 } pmix_iof_write_output_t;
 PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_iof_write_output_t);
 
+/* the pieces of the tag placed around each line of output
+ * from one source on one stream */
+typedef struct {
+    char *lead;  // ahead of any timestamp
+    char *tail;  // after any timestamp, before the data
+    char *end;   // after the data
+    size_t nlead;
+    size_t ntail;
+    size_t nend;
+} pmix_iof_tag_stream_t;
+
+#define PMIX_IOF_TAG_STREAMS 3 // stdout, stderr, stddiag
+
+/* tags for the output of one source, built on first use and
+ * kept on its namespace so lines need not be tagged from scratch */
+typedef struct {
+    pmix_object_t super;
+    /* the flags the tags were built for */
+    bool xml;
+    bool tag;
+    bool tag_detailed;
+    bool tag_fullname;
+    bool rank;
+    char *hostname;
+    char *pid;
+    pmix_iof_tag_stream_t streams[PMIX_IOF_TAG_STREAMS];
+} pmix_iof_tag_t;
+PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_iof_tag_t);
+
 typedef struct {
     pmix_object_t super;
     pmix_event_t ev;
@@ -128,6 +162,9 @@ typedef struct {
     size_t ntargets;
     pmix_info_t *directives;
     size_t ndirs;
+    char *data;      // read buffer, grown to match what is available
+    size_t datasize;
+    bool nosplice;   // splice failed on this fd - don't retry it
 } pmix_iof_read_event_t;
 PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_iof_read_event_t);
 
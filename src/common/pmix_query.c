@@ -420,7 +420,7 @@ static void localquery(int sd, short args, void *cbdata)
     pmix_list_t results;
     pmix_kval_t *kv, *kvnxt;
     pmix_proc_t proc;
-    bool rank_given = false;
+    bool rank_given = false, resolved = true;
     PMIX_HIDE_UNUSED_PARAMS(sd, args);
 
     /* setup the list of local results */
@@ -482,7 +482,40 @@ static void localquery(int sd, short args, void *cbdata)
                 PMIx_Value_load(kv->value, PMIX_STD_ABI_PROVISIONAL_VERSION, PMIX_STRING);
                 pmix_list_append(&cb.kvs, &kv->super);
                 rc = PMIX_SUCCESS;
+            } else if (PMIX_PEER_IS_SERVER(pmix_globals.mypeer)
+                       && 0 == strcmp(queries[n].keys[p], PMIX_QUERY_DMODEX_PREFETCH_HITS)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_server_globals.dmodex_prefetch_hits, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
+            } else if (PMIX_PEER_IS_SERVER(pmix_globals.mypeer)
+                       && 0 == strcmp(queries[n].keys[p], PMIX_QUERY_DMODEX_PREFETCH_MISSES)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_server_globals.dmodex_prefetch_misses, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
+            } else if (0 == strcmp(queries[n].keys[p], PMIX_QUERY_GET_CACHE_HITS)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_client_globals.get_cache_hits, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
+            } else if (0 == strcmp(queries[n].keys[p], PMIX_QUERY_GET_NEGCACHE_HITS)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_client_globals.get_negcache_hits, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
+            } else if (0 == strcmp(queries[n].keys[p], PMIX_QUERY_GET_SERVER_REQUESTS)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_client_globals.get_server_reqs, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
+            } else if (0 == strcmp(queries[n].keys[p], PMIX_QUERY_EVENTS_COALESCED)) {
+                PMIX_KVAL_NEW(kv, cb.key);
+                PMIx_Value_load(kv->value, &pmix_globals.events_coalesced, PMIX_UINT64);
+                pmix_list_append(&cb.kvs, &kv->super);
+                rc = PMIX_SUCCESS;
             } else {
+                resolved = false;
                 PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb);
                 if (PMIX_SUCCESS != rc) {
                     /* not in our gds */
@@ -500,9 +533,15 @@ static void localquery(int sd, short args, void *cbdata)
     }
 
 nextstep:
-    /* pass the queries thru our active plugins with query
-     * interfaces to see if someone can resolve it */
-    rc = pmix_pstrg.query(queries, nqueries, &results, nxtcbfunc, cd);
+    if (resolved) {
+        /* every key is one we answer ourselves, so there is
+         * nothing for the plugins or our host to add */
+        rc = PMIX_OPERATION_SUCCEEDED;
+    } else {
+        /* pass the queries thru our active plugins with query
+         * interfaces to see if someone can resolve it */
+        rc = pmix_pstrg.query(queries, nqueries, &results, nxtcbfunc, cd);
+    }
     if (PMIX_OPERATION_SUCCEEDED == rc) {
         /* if we get here, then all queries were locally
          * resolved, so construct the results for return */
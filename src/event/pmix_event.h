@@ -165,6 +165,7 @@ typedef struct pmix_event_chain_t {
     bool nondefault;
     bool endchain;
     bool cached;
+    bool coalescing;  // gathering duplicates of this event in the event window
     pmix_proc_t source;
     pmix_data_range_t range;
     /* When generating events, callers can specify
@@ -175,6 +176,7 @@ typedef struct pmix_event_chain_t {
     /* the processes that we affected by the event */
     pmix_proc_t *affected;
     size_t naffected;
+    size_t maxaffected; // space in the affected array while coalescing
     /* any info provided by the event generator */
     pmix_info_t *info;
     size_t ninfo;
@@ -224,19 +226,26 @@ PMIX_EXPORT pmix_status_t pmix_notify_server_of_event(pmix_status_t status, cons
 
 PMIX_EXPORT void pmix_event_timeout_cb(int fd, short flags, void *arg);
 
+/* access the events waiting in the window by status and range */
+PMIX_EXPORT pmix_event_chain_t *pmix_event_cached_find(pmix_status_t status,
+                                                       pmix_data_range_t range);
+PMIX_EXPORT void pmix_event_cached_add(pmix_event_chain_t *ch);
+
+/* if coalescing is enabled, hold the given event in the window so that
+ * duplicates of it - events with the same status and range - arriving
+ * before the window closes are merged into it, with its affected procs
+ * becoming the union of theirs. Returns true if the chain was taken */
+PMIX_EXPORT bool pmix_event_coalesce_chain(pmix_event_chain_t *chain);
+
 #define PMIX_REPORT_EVENT(e, p, r, f)                                                          \
     do {                                                                                       \
-        pmix_event_chain_t *ch, *cp;                                                           \
+        pmix_event_chain_t *ch;                                                                \
         size_t _n;                                                                             \
                                                                                                \
-        ch = NULL;                                                                             \
-        /* see if we already have this event cached */                                         \
-        PMIX_LIST_FOREACH (cp, &pmix_globals.cached_events, pmix_event_chain_t) {              \
-            if (cp->status == (e)) {                                                           \
-                ch = cp;                                                                       \
-                break;                                                                         \
-            }                                                                                  \
-        }                                                                                      \
+        /* see if we already have this event cached - a report of the */                       \
+        /* same status with another range reaches other procs, so it */                        \
+        /* gets a chain of its own rather than joining that one */                             \
+        ch = pmix_event_cached_find((e), (r));                                                 \
         if (NULL == ch) {                                                                      \
             /* nope - need to add it */                                                        \
             ch = PMIX_NEW(pmix_event_chain_t);                                                 \
@@ -261,7 +270,7 @@ PMIX_EXPORT void pmix_event_timeout_cb(int fd, short flags, void *arg);
             ch->final_cbfunc = (f);                                                            \
             ch->final_cbdata = ch;                                                             \
             /* cache it */                                                                     \
-            pmix_list_append(&pmix_globals.cached_events, &ch->super);                         \
+            pmix_event_cached_add(ch);                                                         \
             ch->timer_active = true;                                                           \
             pmix_event_assign(&ch->ev, pmix_globals.evbase, -1, 0, pmix_event_timeout_cb, ch); \
             PMIX_POST_OBJECT(ch);                                                              \
@@ -26,6 +26,7 @@
 #include "src/client/pmix_client_ops.h"
 #include "src/include/pmix_globals.h"
 #include "src/mca/bfrops/bfrops.h"
+#include "src/runtime/pmix_rte.h"
 #include "src/server/pmix_server_ops.h"
 
 static void progress_local_event_hdlr(pmix_status_t status, pmix_info_t *results, size_t nresults,
@@ -112,48 +113,168 @@ static void notify_event_cbfunc(struct pmix_peer_t *pr,
     PMIX_RELEASE(cb);
 }
 
+/* thread a newly cached notification onto the tail of the
+ * age-ordered list and onto the tail of the chain for its status */
+static void notify_event_link(pmix_notify_caddy_t *cd)
+{
+    pmix_notify_caddy_t *head = NULL;
+
+    cd->newer = NULL;
+    cd->older = pmix_globals.newest_notification;
+    if (NULL == cd->older) {
+        pmix_globals.oldest_notification = cd;
+    } else {
+        cd->older->newer = cd;
+    }
+    pmix_globals.newest_notification = cd;
+
+    cd->next_status = NULL;
+    if (PMIX_SUCCESS == pmix_hash_table_get_value_uint32(&pmix_globals.notifications_index,
+                                                         (uint32_t) cd->status, (void **) &head)
+        && NULL != head) {
+        cd->prev_status = head->prev_status;
+        head->prev_status->next_status = cd;
+        head->prev_status = cd;
+    } else {
+        cd->prev_status = cd;
+        pmix_hash_table_set_value_uint32(&pmix_globals.notifications_index,
+                                         (uint32_t) cd->status, cd);
+    }
+}
+
+void pmix_notify_event_unlink(pmix_notify_caddy_t *cd)
+{
+    pmix_notify_caddy_t *head = NULL;
+
+    if (NULL == cd->prev_status) {
+        /* not in the cache */
+        return;
+    }
+
+    if (NULL == cd->older) {
+        pmix_globals.oldest_notification = cd->newer;
+    } else {
+        cd->older->newer = cd->newer;
+    }
+    if (NULL == cd->newer) {
+        pmix_globals.newest_notification = cd->older;
+    } else {
+        cd->newer->older = cd->older;
+    }
+
+    pmix_hash_table_get_value_uint32(&pmix_globals.notifications_index, (uint32_t) cd->status,
+                                     (void **) &head);
+    if (head == cd) {
+        if (NULL == cd->next_status) {
+            pmix_hash_table_remove_value_uint32(&pmix_globals.notifications_index,
+                                                (uint32_t) cd->status);
+        } else {
+            cd->next_status->prev_status = cd->prev_status;
+            pmix_hash_table_set_value_uint32(&pmix_globals.notifications_index,
+                                             (uint32_t) cd->status, cd->next_status);
+        }
+    } else if (NULL != head) {
+        cd->prev_status->next_status = cd->next_status;
+        if (NULL == cd->next_status) {
+            head->prev_status = cd->prev_status;
+        } else {
+            cd->next_status->prev_status = cd->prev_status;
+        }
+    }
+    cd->older = NULL;
+    cd->newer = NULL;
+    cd->prev_status = NULL;
+    cd->next_status = NULL;
+}
+
 pmix_status_t pmix_notify_event_cache(pmix_notify_caddy_t *cd)
 {
     pmix_status_t rc;
-    int j;
     pmix_notify_caddy_t *pk;
-    int idx;
-    time_t etime;
 
     /* add to our cache */
     rc = pmix_hotel_checkin(&pmix_globals.notifications, cd, &cd->room);
-    /* if there wasn't room, then search for the longest tenured
-     * occupant and evict them */
-    if (PMIX_SUCCESS != rc) {
-        etime = 0;
-        idx = -1;
-        for (j = 0; j < pmix_globals.max_events; j++) {
-            pmix_hotel_knock(&pmix_globals.notifications, j, (void **) &pk);
-            if (NULL == pk) {
-                /* hey, there is room! */
-                pmix_hotel_checkin_with_res(&pmix_globals.notifications, cd, &cd->room);
-                return PMIX_SUCCESS;
-            }
-            /* check the age */
-            if (0 == j) {
-                etime = pk->ts;
-                idx = j;
-            } else {
-                if (difftime(pk->ts, etime) < 0) {
-                    etime = pk->ts;
-                    idx = j;
-                }
+    /* if there wasn't room, then evict the longest tenured
+     * occupant - it is at the head of the age-ordered list */
+    if (PMIX_SUCCESS != rc && NULL != (pk = pmix_globals.oldest_notification)) {
+        pmix_notify_event_uncache(pk);
+        PMIX_RELEASE(pk);
+        rc = pmix_hotel_checkin(&pmix_globals.notifications, cd, &cd->room);
+    }
+    if (PMIX_SUCCESS == rc) {
+        notify_event_link(cd);
+    }
+    return rc;
+}
+
+void pmix_notify_event_uncache(pmix_notify_caddy_t *cd)
+{
+    if (NULL == cd->prev_status) {
+        /* not in the cache */
+        return;
+    }
+    pmix_hotel_checkout(&pmix_globals.notifications, cd->room);
+    pmix_notify_event_unlink(cd);
+}
+
+pmix_notify_caddy_t *pmix_notify_event_cached(pmix_status_t status)
+{
+    pmix_notify_caddy_t *head = NULL;
+
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint32(&pmix_globals.notifications_index,
+                                                         (uint32_t) status, (void **) &head)) {
+        return NULL;
+    }
+    return head;
+}
+
+/* return the first cached notification, at or after the given index
+ * into the codes, that a registration for those codes could match.
+ * Codes repeated in the array are only visited once */
+static pmix_notify_caddy_t *cached_from(pmix_status_t *codes, size_t ncodes, size_t k)
+{
+    pmix_notify_caddy_t *cd;
+    size_t j;
+
+    for (; k < ncodes; k++) {
+        for (j = 0; j < k; j++) {
+            if (codes[j] == codes[k]) {
+                break;
             }
         }
-        if (0 <= idx) {
-            /* we found the oldest occupant - evict it */
-            pmix_hotel_checkout_and_return_occupant(&pmix_globals.notifications, idx,
-                                                    (void **) &pk);
-            PMIX_RELEASE(pk);
-            rc = pmix_hotel_checkin(&pmix_globals.notifications, cd, &cd->room);
+        if (j == k && NULL != (cd = pmix_notify_event_cached(codes[k]))) {
+            return cd;
         }
     }
-    return rc;
+    return NULL;
+}
+
+pmix_notify_caddy_t *pmix_notify_event_cached_first(pmix_status_t *codes, size_t ncodes)
+{
+    if (NULL == codes) {
+        return pmix_globals.oldest_notification;
+    }
+    return cached_from(codes, ncodes, 0);
+}
+
+pmix_notify_caddy_t *pmix_notify_event_cached_next(pmix_notify_caddy_t *cd,
+                                                   pmix_status_t *codes, size_t ncodes)
+{
+    size_t k;
+
+    if (NULL == codes) {
+        return cd->newer;
+    }
+    if (NULL != cd->next_status) {
+        return cd->next_status;
+    }
+    /* move on to the chain for the next code */
+    for (k = 0; k < ncodes; k++) {
+        if (codes[k] == cd->status) {
+            break;
+        }
+    }
+    return cached_from(codes, ncodes, k + 1);
 }
 
 /* as a client, we pass the notification to our server */
@@ -896,17 +1017,17 @@ static void _notify_client_event(int sd, short args, void *cbdata)
     (void) sd;
     (void) args;
     pmix_notify_caddy_t *cd = (pmix_notify_caddy_t *) cbdata;
-    pmix_regevents_info_t *reginfoptr;
+    pmix_regevents_info_t *reginfoptr, *regs[2];
     pmix_peer_events_info_t *pr;
     pmix_event_chain_t *chain;
     size_t n, nleft;
-    bool matched, holdcd;
+    int r;
+    bool holdcd;
     pmix_buffer_t *bfr;
     pmix_cmd_t cmd = PMIX_NOTIFY_CMD;
     pmix_status_t rc;
-    pmix_list_t trk;
-    pmix_namelist_t *nm;
-    pmix_namespace_t *nptr, *tmp;
+    pmix_bitmap_t notified;
+    pmix_namespace_t *nptr;
     pmix_range_trkr_t rngtrk;
     pmix_proc_t proc;
 
@@ -992,13 +1113,7 @@ static void _notify_client_event(int sd, short args, void *cbdata)
                 ++nleft;
             } else {
                 /* look up the nspace for this proc */
-                nptr = NULL;
-                PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-                    if (PMIX_CHECK_NSPACE(tmp->nspace, cd->targets[n].nspace)) {
-                        nptr = tmp;
-                        break;
-                    }
-                }
+                nptr = pmix_nspace_lookup(cd->targets[n].nspace);
                 /* if we don't yet know it, then nothing to do */
                 if (NULL == nptr) {
                     nleft = SIZE_MAX;
@@ -1085,14 +1200,21 @@ static void _notify_client_event(int sd, short args, void *cbdata)
 
     holdcd = false;
     if (PMIX_RANGE_PROC_LOCAL != cd->range) {
-        PMIX_CONSTRUCT(&trk, pmix_list_t);
+        PMIX_CONSTRUCT(&notified, pmix_bitmap_t);
         rngtrk.procs = NULL;
         rngtrk.nprocs = 0;
-        /* cycle across our registered events and send the message to
-         * any client who registered for it */
-        PMIX_LIST_FOREACH (reginfoptr, &pmix_server_globals.events, pmix_regevents_info_t) {
-            if ((PMIX_MAX_ERR_CONSTANT == reginfoptr->code && !cd->nondefault) ||
-                cd->status == reginfoptr->code) {
+        /* only the registrations for this status and, unless the event
+         * is restricted to non-default handlers, those of the default
+         * handlers can apply - look them up rather than cycling across
+         * every registered event */
+        regs[0] = pmix_server_event_reg_find(cd->status);
+        regs[1] = NULL;
+        if (!cd->nondefault && PMIX_MAX_ERR_CONSTANT != cd->status) {
+            regs[1] = pmix_server_event_reg_find(PMIX_MAX_ERR_CONSTANT);
+        }
+        /* send the message to any client who registered for it */
+        for (r = 0; r < 2; r++) {
+            if (NULL != (reginfoptr = regs[r])) {
                 PMIX_LIST_FOREACH (pr, &reginfoptr->peers, pmix_peer_events_info_t) {
                     /* if this client was the source of the event, then
                      * don't send it back as they will have processed it
@@ -1105,14 +1227,7 @@ static void _notify_client_event(int sd, short args, void *cbdata)
                         continue;
                     }
                     /* if we have already notified this client, then don't do it again */
-                    matched = false;
-                    PMIX_LIST_FOREACH (nm, &trk, pmix_namelist_t) {
-                        if (nm->pname == &pr->peer->info->pname) {
-                            matched = true;
-                            break;
-                        }
-                    }
-                    if (matched) {
+                    if (pmix_bitmap_is_set_bit(&notified, pr->peer->index)) {
                         continue;
                     }
                     /* check if the affected procs (if given) match those they
@@ -1137,9 +1252,7 @@ static void _notify_client_event(int sd, short args, void *cbdata)
                                         PMIx_Error_string(cd->status));
 
                     /* record that we notified this client */
-                    nm = PMIX_NEW(pmix_namelist_t);
-                    nm->pname = &pr->peer->info->pname;
-                    pmix_list_append(&trk, &nm->super);
+                    pmix_bitmap_set_bit(&notified, pr->peer->index);
 
                     bfr = PMIX_NEW(pmix_buffer_t);
                     if (NULL == bfr) {
@@ -1202,7 +1315,7 @@ static void _notify_client_event(int sd, short args, void *cbdata)
                         /* if the event was cached and this is the last one,
                          * then evict this event from the cache */
                         if (0 == cd->nleft) {
-                            pmix_hotel_checkout(&pmix_globals.notifications, cd->room);
+                            pmix_notify_event_uncache(cd);
                             holdcd = false;
                             break;
                         }
@@ -1210,7 +1323,7 @@ static void _notify_client_event(int sd, short args, void *cbdata)
                 }
             }
         }
-        PMIX_LIST_DESTRUCT(&trk);
+        PMIX_DESTRUCT(&notified);
         if (PMIX_RANGE_LOCAL != cd->range &&
             PMIX_CHECK_PROCID(&cd->source, &pmix_globals.myid)) {
             /* if we are the source, then we need to post this upwards as
@@ -1359,11 +1472,173 @@ bool pmix_notify_check_affected(pmix_proc_t *interested, size_t ninterested, pmi
     return false;
 }
 
+static uint64_t cached_event_key(pmix_status_t status, pmix_data_range_t range)
+{
+    return ((uint64_t) (uint32_t) status << 32) | (uint64_t) range;
+}
+
+typedef struct {
+    uint64_t evkey;
+    pmix_proc_t proc;
+} coalesced_proc_key_t;
+
+static void coalesced_proc_key(coalesced_proc_key_t *key, pmix_event_chain_t *ch,
+                               const pmix_proc_t *proc)
+{
+    /* zero the whole key so the unused part of the nspace hashes alike */
+    memset(key, 0, sizeof(*key));
+    key->evkey = cached_event_key(ch->status, ch->range);
+    PMIX_LOAD_PROCID(&key->proc, proc->nspace, proc->rank);
+}
+
+pmix_event_chain_t *pmix_event_cached_find(pmix_status_t status, pmix_data_range_t range)
+{
+    pmix_event_chain_t *ch = NULL;
+
+    if (0 == pmix_hash_table_get_size(&pmix_globals.cached_events_index)) {
+        return NULL;
+    }
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint64(&pmix_globals.cached_events_index,
+                                                         cached_event_key(status, range),
+                                                         (void **) &ch)) {
+        return NULL;
+    }
+    return ch;
+}
+
+void pmix_event_cached_add(pmix_event_chain_t *ch)
+{
+    pmix_list_append(&pmix_globals.cached_events, &ch->super);
+    pmix_hash_table_set_value_uint64(&pmix_globals.cached_events_index,
+                                     cached_event_key(ch->status, ch->range), ch);
+}
+
+/* add those of the given procs that are not already
+ * in the affected array of the coalescing chain */
+static void coalesce_affected(pmix_event_chain_t *ch, const pmix_proc_t *procs, size_t nprocs)
+{
+    coalesced_proc_key_t key;
+    pmix_proc_t *tmp;
+    void *ptr;
+    size_t n;
+
+    for (n = 0; n < nprocs; n++) {
+        coalesced_proc_key(&key, ch, &procs[n]);
+        if (PMIX_SUCCESS == pmix_hash_table_get_value_ptr(&pmix_globals.coalesced_procs, &key,
+                                                          sizeof(key), &ptr)) {
+            continue;
+        }
+        if (ch->naffected == ch->maxaffected) {
+            ch->maxaffected = (0 == ch->maxaffected) ? 8 : 2 * ch->maxaffected;
+            tmp = (pmix_proc_t *) realloc(ch->affected, ch->maxaffected * sizeof(pmix_proc_t));
+            if (NULL == tmp) {
+                PMIX_ERROR_LOG(PMIX_ERR_NOMEM);
+                return;
+            }
+            ch->affected = tmp;
+        }
+        memcpy(&ch->affected[ch->naffected], &procs[n], sizeof(pmix_proc_t));
+        ++ch->naffected;
+        pmix_hash_table_set_value_ptr(&pmix_globals.coalesced_procs, &key, sizeof(key), NULL);
+    }
+}
+
+bool pmix_event_coalesce_chain(pmix_event_chain_t *chain)
+{
+    pmix_event_chain_t *ch;
+    pmix_proc_t *affected;
+    size_t naffected;
+
+    if (!pmix_event_coalesce || NULL == chain->affected || 0 == chain->naffected) {
+        return false;
+    }
+
+    ch = pmix_event_cached_find(chain->status, chain->range);
+    if (NULL != ch) {
+        if (!ch->coalescing) {
+            /* a locally reported event is in the window - leave it be */
+            return false;
+        }
+        /* merge this event into the one already waiting */
+        coalesce_affected(ch, chain->affected, chain->naffected);
+        ++pmix_globals.events_coalesced;
+        pmix_output_verbose(2, pmix_client_globals.event_output,
+                            "%s event %s coalesced - %lu procs now affected",
+                            PMIX_NAME_PRINT(&pmix_globals.myid),
+                            PMIx_Error_string(chain->status), (unsigned long) ch->naffected);
+        PMIX_RELEASE(chain);
+        return true;
+    }
+
+    /* open a window for this event - rebuild its affected
+     * array so that duplicates can be merged into it */
+    affected = chain->affected;
+    naffected = chain->naffected;
+    chain->affected = NULL;
+    chain->naffected = 0;
+    chain->maxaffected = 0;
+    chain->coalescing = true;
+    coalesce_affected(chain, affected, naffected);
+    PMIX_PROC_FREE(affected, naffected);
+    pmix_event_cached_add(chain);
+    chain->timer_active = true;
+    pmix_event_assign(&chain->ev, pmix_globals.evbase, -1, 0, pmix_event_timeout_cb, chain);
+    PMIX_POST_OBJECT(chain);
+    pmix_event_add(&chain->ev, &pmix_globals.event_window);
+    return true;
+}
+
+/* hand the handlers the union of the affected procs in place of
+ * whatever the first of the coalesced events carried */
+static void coalesce_info(pmix_event_chain_t *ch)
+{
+    pmix_info_t *info;
+    pmix_data_array_t darray;
+    size_t n, m, nalloc;
+
+    /* count what we keep - the merged affected procs take one more */
+    m = 1;
+    for (n = 0; n < ch->ninfo; n++) {
+        if (!PMIX_CHECK_KEY(&ch->info[n], PMIX_EVENT_AFFECTED_PROC)
+            && !PMIX_CHECK_KEY(&ch->info[n], PMIX_EVENT_AFFECTED_PROCS)) {
+            ++m;
+        }
+    }
+    /* we always leave space for event hdlr name and a callback object */
+    nalloc = m + 2;
+    PMIX_INFO_CREATE(info, nalloc);
+    if (NULL == info) {
+        return;
+    }
+    m = 0;
+    for (n = 0; n < ch->ninfo; n++) {
+        if (PMIX_CHECK_KEY(&ch->info[n], PMIX_EVENT_AFFECTED_PROC)
+            || PMIX_CHECK_KEY(&ch->info[n], PMIX_EVENT_AFFECTED_PROCS)) {
+            continue;
+        }
+        PMIX_INFO_XFER(&info[m], &ch->info[n]);
+        ++m;
+    }
+    darray.type = PMIX_PROC;
+    darray.size = ch->naffected;
+    darray.array = ch->affected;
+    PMIX_INFO_LOAD(&info[m], PMIX_EVENT_AFFECTED_PROCS, &darray, PMIX_DATA_ARRAY);
+    ++m;
+    if (NULL != ch->info) {
+        PMIX_INFO_FREE(ch->info, ch->nallocated);
+    }
+    ch->info = info;
+    ch->ninfo = m;
+    ch->nallocated = nalloc;
+}
+
 void pmix_event_timeout_cb(int fd, short flags, void *arg)
 {
     (void) fd;
     (void) flags;
     pmix_event_chain_t *ch = (pmix_event_chain_t *) arg;
+    coalesced_proc_key_t key;
+    size_t n;
 
     /* need to acquire the object from its originating thread */
     PMIX_ACQUIRE_OBJECT(ch);
@@ -1372,6 +1647,22 @@ void pmix_event_timeout_cb(int fd, short flags, void *arg)
 
     /* remove it from the list */
     pmix_list_remove_item(&pmix_globals.cached_events, &ch->super);
+    pmix_hash_table_remove_value_uint64(&pmix_globals.cached_events_index,
+                                        cached_event_key(ch->status, ch->range));
+
+    if (ch->coalescing) {
+        /* the window is closed - deliver the merged event */
+        for (n = 0; n < ch->naffected; n++) {
+            coalesced_proc_key(&key, ch, &ch->affected[n]);
+            pmix_hash_table_remove_value_ptr(&pmix_globals.coalesced_procs, &key, sizeof(key));
+        }
+        ch->coalescing = false;
+        if (1 < ch->naffected) {
+            coalesce_info(ch);
+        }
+        pmix_invoke_local_event_hdlr(ch);
+        return;
+    }
 
     /* process this event thru the regular channels */
     if (PMIX_PEER_IS_SERVER(pmix_globals.mypeer) &&
@@ -1526,8 +1817,10 @@ static void chcon(pmix_event_chain_t *p)
     p->targets = NULL;
     p->ntargets = 0;
     p->range = PMIX_RANGE_UNDEF;
+    p->coalescing = false;
     p->affected = NULL;
     p->naffected = 0;
+    p->maxaffected = 0;
     p->info = NULL;
     p->ninfo = 0;
     p->nallocated = 0;
@@ -358,31 +358,15 @@ static pmix_status_t _add_hdlr(pmix_rshift_caddy_t *cd, pmix_list_t *xfer)
 static void check_cached_events(pmix_rshift_caddy_t *cd)
 {
     size_t n;
-    pmix_notify_caddy_t *ncd;
-    bool found, matched;
+    pmix_notify_caddy_t *ncd, *next;
+    bool matched;
     pmix_event_chain_t *chain;
-    int j;
 
-    for (j = 0; j < pmix_globals.max_events; j++) {
-        pmix_hotel_knock(&pmix_globals.notifications, j, (void **) &ncd);
-        if (NULL == ncd) {
-            continue;
-        }
-        found = false;
-        if (NULL == cd->codes) {
-            if (!ncd->nondefault) {
-                /* they registered a default event handler - always matches */
-                found = true;
-            }
-        } else {
-            for (n = 0; n < cd->ncodes; n++) {
-                if (cd->codes[n] == ncd->status) {
-                    found = true;
-                    break;
-                }
-            }
-        }
-        if (!found) {
+    for (ncd = pmix_notify_event_cached_first(cd->codes, cd->ncodes); NULL != ncd; ncd = next) {
+        next = pmix_notify_event_cached_next(ncd, cd->codes, cd->ncodes);
+        /* a default event handler matches anything not
+         * restricted to non-default handlers */
+        if (NULL == cd->codes && ncd->nondefault) {
             continue;
         }
         /* if we were given specific targets, check if we are one */
@@ -446,7 +430,7 @@ static void check_cached_events(pmix_rshift_caddy_t *cd)
         }
         /* check this event out of the cache since we
          * are processing it */
-        pmix_hotel_checkout(&pmix_globals.notifications, ncd->room);
+        pmix_notify_event_uncache(ncd);
         /* release the storage */
         PMIX_RELEASE(ncd);
 
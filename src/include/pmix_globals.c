@@ -149,10 +149,13 @@ static void nscon(pmix_namespace_t *p)
     PMIX_CONSTRUCT(&p->setup_data, pmix_list_t);
     memset(&p->iof_flags, 0, sizeof(p->iof_flags));
     PMIX_CONSTRUCT(&p->sinks, pmix_list_t);
-
+    PMIX_CONSTRUCT(&p->iof_tags, pmix_pointer_array_t);
 }
 static void nsdes(pmix_namespace_t *p)
 {
+    pmix_object_t *obj;
+    int n;
+
     if (NULL != p->nspace) {
         free(p->nspace);
     }
@@ -174,6 +177,12 @@ static void nsdes(pmix_namespace_t *p)
         free(p->iof_flags.directory);
     }
     PMIX_LIST_DESTRUCT(&p->sinks);
+    for (n = 0; n < p->iof_tags.size; n++) {
+        if (NULL != (obj = (pmix_object_t *) pmix_pointer_array_get_item(&p->iof_tags, n))) {
+            PMIX_RELEASE(obj);
+        }
+    }
+    PMIX_DESTRUCT(&p->iof_tags);
 }
 PMIX_EXPORT PMIX_CLASS_INSTANCE(pmix_namespace_t, pmix_list_item_t, nscon, nsdes);
 
@@ -225,6 +234,9 @@ static void pcon(pmix_peer_t *p)
     PMIX_CONSTRUCT(&p->send_queue, pmix_list_t);
     p->send_msg = NULL;
     p->recv_msg = NULL;
+    p->recv_buf = NULL;
+    p->recv_buf_start = 0;
+    p->recv_buf_end = 0;
     p->commit_cnt = 0;
     PMIX_CONSTRUCT(&p->epilog.cleanup_dirs, pmix_list_t);
     PMIX_CONSTRUCT(&p->epilog.cleanup_files, pmix_list_t);
@@ -254,6 +266,9 @@ static void pdes(pmix_peer_t *p)
     if (NULL != p->recv_msg) {
         PMIX_RELEASE(p->recv_msg);
     }
+    if (NULL != p->recv_buf) {
+        free(p->recv_buf);
+    }
     /* perform any epilog */
     pmix_execute_epilog(&p->epilog);
     /* cleanup the epilog */
@@ -340,6 +355,7 @@ static void lgcon(pmix_get_logic_t *p)
     p->immediate = false;
     p->add_immediate = false;
     p->refresh_cache = false;
+    p->use_cache = false;
     p->scope = PMIX_SCOPE_UNDEF;
     p->sessioninfo = false;
     p->sessiondirective = false;
@@ -462,6 +478,10 @@ static void ncon(pmix_notify_caddy_t *p)
     p->ts = tv.tv_sec;
 #endif
     p->room = -1;
+    p->older = NULL;
+    p->newer = NULL;
+    p->prev_status = NULL;
+    p->next_status = NULL;
     memset(p->source.nspace, 0, PMIX_MAX_NSLEN + 1);
     p->source.rank = PMIX_RANK_UNDEF;
     p->range = PMIX_RANGE_UNDEF;
@@ -698,6 +718,64 @@ static bool dirpath_is_empty(const char *path)
     return true;
 }
 
+pmix_namespace_t *pmix_nspace_lookup(const char *nspace)
+{
+    pmix_namespace_t *nptr = NULL;
+
+    if (PMIX_NSPACE_INVALID(nspace)) {
+        /* an empty nspace is a wildcard under PMIX_CHECK_NSPACE, so
+         * return the first entry just as the list walk did */
+        if (pmix_list_is_empty(&pmix_globals.nspaces)) {
+            return NULL;
+        }
+        return (pmix_namespace_t *) pmix_list_get_first(&pmix_globals.nspaces);
+    }
+    if (0 == pmix_globals.nspace_index.ht_capacity) {
+        return NULL;
+    }
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_ptr(&pmix_globals.nspace_index, nspace,
+                                                      pmix_nslen(nspace), (void **) &nptr)) {
+        return NULL;
+    }
+    return nptr;
+}
+
+static void nspace_index(pmix_namespace_t *nptr)
+{
+    if (NULL == nptr->nspace) {
+        return;
+    }
+    if (0 == pmix_globals.nspace_index.ht_capacity) {
+        pmix_hash_table_init(&pmix_globals.nspace_index, 256);
+    }
+    pmix_hash_table_set_value_ptr(&pmix_globals.nspace_index, nptr->nspace,
+                                  pmix_nslen(nptr->nspace), nptr);
+}
+
+void pmix_nspace_add(pmix_namespace_t *nptr)
+{
+    pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+    nspace_index(nptr);
+}
+
+/* as pmix_nspace_add, but put it at the head of the list
+ * so that it is the first one found by a wildcard lookup */
+void pmix_nspace_prepend(pmix_namespace_t *nptr)
+{
+    pmix_list_prepend(&pmix_globals.nspaces, &nptr->super);
+    nspace_index(nptr);
+}
+
+void pmix_nspace_remove(pmix_namespace_t *nptr)
+{
+    /* only drop the index entry if it refers to this object */
+    if (nptr == pmix_nspace_lookup(nptr->nspace)) {
+        pmix_hash_table_remove_value_ptr(&pmix_globals.nspace_index, nptr->nspace,
+                                         pmix_nslen(nptr->nspace));
+    }
+    pmix_list_remove_item(&pmix_globals.nspaces, &nptr->super);
+}
+
 int pmix_event_assign(struct event *ev, pmix_event_base_t *evbase, int fd, short arg,
                       event_callback_fn cbfn, void *cbd)
 {
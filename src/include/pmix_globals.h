@@ -108,10 +108,13 @@ do {                                    \
     }                                   \
 } while(0)
 
-typedef struct {
+typedef struct pmix_dstor_t {
     uint32_t index;
     uint32_t qualindex;
     pmix_value_t *value;
+    /* next stored value for the same key - i.e., the
+     * same key with a different set of qualifiers */
+    struct pmix_dstor_t *next;
 } pmix_dstor_t;
 #define PMIX_DSTOR_NEW(d, k)                                \
 do {                                                        \
@@ -120,6 +123,7 @@ do {                                                        \
         (d)->index = k;                                     \
         (d)->qualindex = UINT32_MAX;                        \
         (d)->value = NULL;                                  \
+        (d)->next = NULL;                                   \
     }                                                       \
 } while(0)
 #define PMIX_DSTOR_RELEASE(d)           \
@@ -298,6 +302,7 @@ typedef struct {
                             // for setting up the local node for this nspace/application
     pmix_iof_flags_t iof_flags;   // output formatting flags
     pmix_list_t sinks;   // IOF write events for output to files or directories
+    pmix_pointer_array_t iof_tags; // IOF output tags for each rank, built on first output
 } pmix_namespace_t;
 PMIX_CLASS_DECLARATION(pmix_namespace_t);
 
@@ -384,6 +389,9 @@ typedef struct pmix_peer_t {
     pmix_list_t send_queue;    /**< list of messages to send */
     pmix_ptl_send_t *send_msg; /**< current send in progress */
     pmix_ptl_recv_t *recv_msg; /**< current recv in progress */
+    char *recv_buf;            /**< read-ahead buffer for incoming messages */
+    size_t recv_buf_start;     /**< offset of the first unparsed byte */
+    size_t recv_buf_end;       /**< offset just past the last byte read */
     int commit_cnt;
     pmix_epilog_t epilog; /**< things to be performed upon
                                termination of this peer */
@@ -445,7 +453,7 @@ PMIX_CLASS_DECLARATION(pmix_grpinfo_t);
 
 /* define a tracker for collective operations
  * - instanced in pmix_server_ops.c */
-typedef struct {
+typedef struct pmix_server_trkr_t {
     pmix_list_item_t super;
     pmix_event_t ev;
     bool event_active;
@@ -472,6 +480,8 @@ typedef struct {
     pmix_modex_cbfunc_t modexcbfunc;
     pmix_op_cbfunc_t op_cbfunc;
     void *cbdata;
+    uint64_t sig;                       // signature of the id or participants+type
+    struct pmix_server_trkr_t *signext; // next tracker with the same signature
 } pmix_server_trkr_t;
 PMIX_CLASS_DECLARATION(pmix_server_trkr_t);
 
@@ -538,6 +548,7 @@ typedef struct {
     bool immediate;
     bool add_immediate;
     bool refresh_cache;
+    bool use_cache;
     pmix_scope_t scope;
     bool sessioninfo;
     bool sessiondirective;
@@ -611,7 +622,7 @@ PMIX_CLASS_DECLARATION(pmix_cb_t);
         pmix_event_evtimer_add(&(r)->ev, &_tv);                          \
     } while (0)
 
-typedef struct {
+typedef struct pmix_notify_caddy_t {
     pmix_object_t super;
     pmix_event_t ev;
     pmix_lock_t lock;
@@ -620,6 +631,14 @@ typedef struct {
     time_t ts;
     /* what room of the hotel they are in */
     int room;
+    /* while cached, the notification is threaded onto the
+     * age-ordered list of cached notifications and onto the
+     * chain of those cached for the same status. The head of
+     * each status chain points back to the tail of that chain */
+    struct pmix_notify_caddy_t *older;
+    struct pmix_notify_caddy_t *newer;
+    struct pmix_notify_caddy_t *prev_status;
+    struct pmix_notify_caddy_t *next_status;
     pmix_status_t status;
     pmix_proc_t source;
     pmix_data_range_t range;
@@ -681,10 +700,16 @@ typedef struct {
     bool commits_pending;
     struct timeval event_window;
     pmix_list_t cached_events;         // events waiting in the window prior to processing
+    pmix_hash_table_t cached_events_index; // (status, range) -> chain on cached_events
+    pmix_hash_table_t coalesced_procs; // (status, range, proc) already merged into a chain
+    uint64_t events_coalesced;         // number of events merged into another in the window
     pmix_pointer_array_t iof_requests; // array of pmix_iof_req_t IOF requests
     int max_events;                    // size of the notifications hotel
     int event_eviction_time;           // max time to cache notifications
     pmix_hotel_t notifications;        // hotel of pending notifications
+    pmix_notify_caddy_t *oldest_notification; // age-ordered list of cached notifications
+    pmix_notify_caddy_t *newest_notification;
+    pmix_hash_table_t notifications_index; // status -> chain of cached notifications
     /* IOF controls */
     bool pushstdin;
     pmix_list_t stdin_targets; // list of pmix_namelist_t
@@ -693,19 +718,45 @@ typedef struct {
     bool timestamp_output;
     size_t output_limit;
     pmix_list_t nspaces;
+    pmix_hash_table_t nspace_index; // hash of nspace string -> pmix_namespace_t on nspaces
     pmix_topology_t topology;
     pmix_cpuset_t cpuset;
     bool external_topology;
     bool external_progress;
     pmix_iof_flags_t iof_flags;
     pmix_pointer_array_t keyindex;  // translation table of key <-> index
+    pmix_hash_table_t keytable;     // hash of key string -> keyindex entry
     uint32_t next_keyid;
 } pmix_globals_t;
 
 /* provide access to a function to cleanup epilogs */
 PMIX_EXPORT void pmix_execute_epilog(pmix_epilog_t *ep);
 
+/* access to the cache of notifications. Notifications must leave
+ * the cache through pmix_notify_event_uncache so that the age and
+ * status ordering of the cache stays in step with the hotel */
 PMIX_EXPORT pmix_status_t pmix_notify_event_cache(pmix_notify_caddy_t *cd);
+PMIX_EXPORT void pmix_notify_event_uncache(pmix_notify_caddy_t *cd);
+PMIX_EXPORT void pmix_notify_event_unlink(pmix_notify_caddy_t *cd);
+PMIX_EXPORT pmix_notify_caddy_t *pmix_notify_event_cached(pmix_status_t status);
+
+/* walk the cached notifications that a registration for the given
+ * codes (NULL for a default handler) could match, oldest first for
+ * each code. Fetch the next one before uncaching the current one */
+PMIX_EXPORT pmix_notify_caddy_t *pmix_notify_event_cached_first(pmix_status_t *codes,
+                                                                size_t ncodes);
+PMIX_EXPORT pmix_notify_caddy_t *pmix_notify_event_cached_next(pmix_notify_caddy_t *cd,
+                                                               pmix_status_t *codes,
+                                                               size_t ncodes);
+
+/* access to the registry of known namespaces. Namespaces must be
+ * added and removed through these so that the index used for
+ * lookup stays in step with the pmix_globals.nspaces list. The
+ * list retains the reference on the namespace object */
+PMIX_EXPORT pmix_namespace_t *pmix_nspace_lookup(const char *nspace);
+PMIX_EXPORT void pmix_nspace_add(pmix_namespace_t *nptr);
+PMIX_EXPORT void pmix_nspace_prepend(pmix_namespace_t *nptr);
+PMIX_EXPORT void pmix_nspace_remove(pmix_namespace_t *nptr);
 
 PMIX_EXPORT extern pmix_globals_t pmix_globals;
 PMIX_EXPORT extern pmix_lock_t pmix_global_lock;
@@ -216,6 +216,23 @@ PMIX_EXPORT extern pmix_bfrops_globals_t pmix_bfrops_globals;
         }                                                                            \
     } while (0)
 
+/* Lookup the pack (or unpack) function for a type once, so that a loop
+ * over many elements of that type can call it without going back
+ * through the table each time. f is set to NULL if the type is unknown */
+#define PMIX_BFROPS_PACK_FN(f, t, arr)                                               \
+    do {                                                                             \
+        pmix_bfrop_type_info_t *__info;                                              \
+        __info = (pmix_bfrop_type_info_t *) pmix_pointer_array_get_item((arr), (t)); \
+        (f) = (NULL == __info) ? NULL : __info->odti_pack_fn;                        \
+    } while (0)
+
+#define PMIX_BFROPS_UNPACK_FN(f, t, arr)                                             \
+    do {                                                                             \
+        pmix_bfrop_type_info_t *__info;                                              \
+        __info = (pmix_bfrop_type_info_t *) pmix_pointer_array_get_item((arr), (t)); \
+        (f) = (NULL == __info) ? NULL : __info->odti_unpack_fn;                      \
+    } while (0)
+
 /* NOTE: do not need to deal with endianness here, as the unpacking of
    the underling sender-side type will do that for us.  Repeat: the
    data in tmpbuf[] is already in host byte order. */
@@ -282,6 +299,78 @@ PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_bfrop_type_info_t);
         pmix_pointer_array_set_item((arr), (t), _info);               \
     } while (0)
 
+/*
+ * Bulk conversion of fixed-width integer arrays between host and
+ * network byte order. These are a straight memcpy on big-endian
+ * hosts. Elsewhere the swap loop makes no calls, so the compiler
+ * can vectorize it. Neither src nor dst need be aligned.
+ */
+#if defined(__GNUC__)
+#    define PMIX_BFROP_BSWAP16(x) __builtin_bswap16(x)
+#    define PMIX_BFROP_BSWAP32(x) __builtin_bswap32(x)
+#    define PMIX_BFROP_BSWAP64(x) __builtin_bswap64(x)
+#else
+#    define PMIX_BFROP_BSWAP16(x) pmix_htons(x)
+#    define PMIX_BFROP_BSWAP32(x) htonl(x)
+#    define PMIX_BFROP_BSWAP64(x) pmix_hton64(x)
+#endif
+
+static inline void pmix_bfrop_swap16_copy(void *dst, const void *src, size_t n)
+{
+#ifdef WORDS_BIGENDIAN
+    memcpy(dst, src, n * sizeof(uint16_t));
+#else
+    const char *s = (const char *) src;
+    char *d = (char *) dst;
+    uint16_t tmp;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        memcpy(&tmp, s + i * sizeof(tmp), sizeof(tmp));
+        tmp = PMIX_BFROP_BSWAP16(tmp);
+        memcpy(d + i * sizeof(tmp), &tmp, sizeof(tmp));
+    }
+#endif
+}
+
+static inline void pmix_bfrop_swap32_copy(void *dst, const void *src, size_t n)
+{
+#ifdef WORDS_BIGENDIAN
+    memcpy(dst, src, n * sizeof(uint32_t));
+#else
+    const char *s = (const char *) src;
+    char *d = (char *) dst;
+    uint32_t tmp;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        memcpy(&tmp, s + i * sizeof(tmp), sizeof(tmp));
+        tmp = PMIX_BFROP_BSWAP32(tmp);
+        memcpy(d + i * sizeof(tmp), &tmp, sizeof(tmp));
+    }
+#endif
+}
+
+static inline void pmix_bfrop_swap64_copy(void *dst, const void *src, size_t n)
+{
+    /* matches pmix_hton64, which leaves the value alone
+     * if the byteswap routines are unavailable */
+#if defined(WORDS_BIGENDIAN) || !defined(HAVE_UNIX_BYTESWAP)
+    memcpy(dst, src, n * sizeof(uint64_t));
+#else
+    const char *s = (const char *) src;
+    char *d = (char *) dst;
+    uint64_t tmp;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        memcpy(&tmp, s + i * sizeof(tmp), sizeof(tmp));
+        tmp = PMIX_BFROP_BSWAP64(tmp);
+        memcpy(d + i * sizeof(tmp), &tmp, sizeof(tmp));
+    }
+#endif
+}
+
 /* API Stub functions */
 PMIX_EXPORT char *pmix_bfrops_stub_get_available_modules(void);
 PMIX_EXPORT pmix_status_t pmix_bfrops_stub_assign_module(struct pmix_peer_t *peer,
@@ -1194,11 +1194,30 @@ char *pmix_bfrop_buffer_extend(pmix_buffer_t *buffer, size_t bytes_to_add)
     size_t required, to_alloc;
     size_t pack_offset, unpack_offset;
 
+    char *ptr;
+
     /* Check to see if we have enough space already */
     if (0 == bytes_to_add) {
         return buffer->pack_ptr;
     }
 
+    if (buffer->measure) {
+        /* the data is thrown away, so every pack of a fixed-size
+         * field can reuse the same space - only bytes_used must keep
+         * growing. Raw bytes never get here when measuring */
+        if (buffer->bytes_allocated < bytes_to_add) {
+            ptr = (char *) realloc(buffer->base_ptr, bytes_to_add);
+            if (NULL == ptr) {
+                return NULL;
+            }
+            buffer->base_ptr = ptr;
+            buffer->bytes_allocated = bytes_to_add;
+        }
+        buffer->pack_ptr = buffer->base_ptr;
+        buffer->unpack_ptr = buffer->base_ptr;
+        return buffer->pack_ptr;
+    }
+
     if ((buffer->bytes_allocated - buffer->bytes_used) >= bytes_to_add) {
         return buffer->pack_ptr;
     }
@@ -1218,22 +1237,23 @@ char *pmix_bfrop_buffer_extend(pmix_buffer_t *buffer, size_t bytes_to_add)
         }
     }
 
+    /* no need to zero the new space - everything up to
+     * bytes_used is written by the pack functions */
     if (NULL != buffer->base_ptr) {
         pack_offset = ((char *) buffer->pack_ptr) - ((char *) buffer->base_ptr);
         unpack_offset = ((char *) buffer->unpack_ptr) - ((char *) buffer->base_ptr);
-        buffer->base_ptr = (char *) realloc(buffer->base_ptr, to_alloc);
-        memset(buffer->base_ptr + pack_offset, 0, to_alloc - buffer->bytes_allocated);
+        ptr = (char *) realloc(buffer->base_ptr, to_alloc);
     } else {
         pack_offset = 0;
         unpack_offset = 0;
         buffer->bytes_used = 0;
-        buffer->base_ptr = (char *) malloc(to_alloc);
-        memset(buffer->base_ptr, 0, to_alloc);
+        ptr = (char *) malloc(to_alloc);
     }
 
-    if (NULL == buffer->base_ptr) {
+    if (NULL == ptr) {
         return NULL;
     }
+    buffer->base_ptr = ptr;
     buffer->pack_ptr = ((char *) buffer->base_ptr) + pack_offset;
     buffer->unpack_ptr = ((char *) buffer->base_ptr) + unpack_offset;
     buffer->bytes_allocated = to_alloc;
@@ -1242,6 +1262,122 @@ char *pmix_bfrop_buffer_extend(pmix_buffer_t *buffer, size_t bytes_to_add)
     return buffer->pack_ptr;
 }
 
+pmix_status_t pmix_bfrops_base_reserve(pmix_buffer_t *buffer, size_t bytes)
+{
+    if (buffer->measure) {
+        return PMIX_SUCCESS;
+    }
+    if (NULL == pmix_bfrop_buffer_extend(buffer, bytes)) {
+        return PMIX_ERR_OUT_OF_RESOURCE;
+    }
+    return PMIX_SUCCESS;
+}
+
+pmix_status_t pmix_bfrops_base_attach(pmix_buffer_t *buffer, char *bytes, size_t size,
+                                      pmix_release_cbfunc_t relfn, void *relcbd)
+{
+    pmix_buffer_ref_t *ref;
+    char *dst;
+
+    if (buffer->measure) {
+        buffer->bytes_used += size;
+        if (NULL != relfn) {
+            relfn(relcbd);
+        }
+        return PMIX_SUCCESS;
+    }
+
+    if (size < PMIX_BFROPS_ATTACH_MIN) {
+        /* not worth a separate segment on the wire */
+        if (0 < size) {
+            if (NULL == (dst = pmix_bfrop_buffer_extend(buffer, size))) {
+                if (NULL != relfn) {
+                    relfn(relcbd);
+                }
+                return PMIX_ERR_OUT_OF_RESOURCE;
+            }
+            memcpy(dst, bytes, size);
+            buffer->pack_ptr += size;
+            buffer->bytes_used += size;
+        }
+        if (NULL != relfn) {
+            relfn(relcbd);
+        }
+        return PMIX_SUCCESS;
+    }
+
+    if (NULL == buffer->refs) {
+        buffer->refs = PMIX_NEW(pmix_list_t);
+        if (NULL == buffer->refs) {
+            if (NULL != relfn) {
+                relfn(relcbd);
+            }
+            return PMIX_ERR_NOMEM;
+        }
+    }
+    ref = PMIX_NEW(pmix_buffer_ref_t);
+    if (NULL == ref) {
+        if (NULL != relfn) {
+            relfn(relcbd);
+        }
+        return PMIX_ERR_NOMEM;
+    }
+    ref->offset = buffer->bytes_used;
+    ref->bytes = bytes;
+    ref->size = size;
+    ref->relfn = relfn;
+    ref->relcbd = relcbd;
+    pmix_list_append(buffer->refs, &ref->super);
+    buffer->ref_bytes += size;
+    return PMIX_SUCCESS;
+}
+
+pmix_status_t pmix_bfrops_base_flatten(pmix_buffer_t *buffer)
+{
+    pmix_buffer_ref_t *ref;
+    size_t total, upoff, nxt, prev = 0;
+    char *data, *dst;
+
+    if (NULL == buffer->refs || 0 == buffer->ref_bytes) {
+        return PMIX_SUCCESS;
+    }
+
+    total = PMIX_BUFFER_PAYLOAD_SIZE(buffer);
+    data = (char *) malloc(total);
+    if (NULL == data) {
+        return PMIX_ERR_NOMEM;
+    }
+    upoff = buffer->unpack_ptr - buffer->base_ptr;
+    nxt = upoff;
+    dst = data;
+    PMIX_LIST_FOREACH (ref, buffer->refs, pmix_buffer_ref_t) {
+        memcpy(dst, buffer->base_ptr + prev, ref->offset - prev);
+        dst += ref->offset - prev;
+        prev = ref->offset;
+        memcpy(dst, ref->bytes, ref->size);
+        dst += ref->size;
+        if (ref->offset < upoff) {
+            nxt += ref->size;
+        }
+    }
+    if (prev < buffer->bytes_used) {
+        memcpy(dst, buffer->base_ptr + prev, buffer->bytes_used - prev);
+    }
+
+    if (NULL != buffer->base_ptr) {
+        free(buffer->base_ptr);
+    }
+    buffer->base_ptr = data;
+    buffer->bytes_allocated = total;
+    buffer->bytes_used = total;
+    buffer->pack_ptr = data + total;
+    buffer->unpack_ptr = data + nxt;
+    PMIX_LIST_RELEASE(buffer->refs);
+    buffer->refs = NULL;
+    buffer->ref_bytes = 0;
+    return PMIX_SUCCESS;
+}
+
 /*
  * Internal function that checks to see if the specified number of bytes
  * remain in the buffer for unpacking
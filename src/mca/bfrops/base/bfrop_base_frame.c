@@ -145,6 +145,9 @@ static void pmix_buffer_construct(pmix_buffer_t *buffer)
     /* Make everything NULL to begin with */
     buffer->base_ptr = buffer->pack_ptr = buffer->unpack_ptr = NULL;
     buffer->bytes_allocated = buffer->bytes_used = 0;
+    buffer->measure = false;
+    buffer->refs = NULL;
+    buffer->ref_bytes = 0;
 }
 
 static void pmix_buffer_destruct(pmix_buffer_t *buffer)
@@ -152,10 +155,32 @@ static void pmix_buffer_destruct(pmix_buffer_t *buffer)
     if (NULL != buffer->base_ptr) {
         free(buffer->base_ptr);
     }
+    if (NULL != buffer->refs) {
+        PMIX_LIST_RELEASE(buffer->refs);
+    }
 }
 
 PMIX_CLASS_INSTANCE(pmix_buffer_t, pmix_object_t, pmix_buffer_construct, pmix_buffer_destruct);
 
+static void pmix_buffer_ref_construct(pmix_buffer_ref_t *ref)
+{
+    ref->offset = 0;
+    ref->bytes = NULL;
+    ref->size = 0;
+    ref->relfn = NULL;
+    ref->relcbd = NULL;
+}
+
+static void pmix_buffer_ref_destruct(pmix_buffer_ref_t *ref)
+{
+    if (NULL != ref->relfn) {
+        ref->relfn(ref->relcbd);
+    }
+}
+
+PMIX_CLASS_INSTANCE(pmix_buffer_ref_t, pmix_list_item_t, pmix_buffer_ref_construct,
+                    pmix_buffer_ref_destruct);
+
 static void pmix_bfrop_type_info_construct(pmix_bfrop_type_info_t *obj)
 {
     obj->odti_name = NULL;
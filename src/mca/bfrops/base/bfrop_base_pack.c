@@ -194,6 +194,12 @@ pmix_status_t pmix_bfrops_base_pack_byte(pmix_pointer_array_t *regtypes, pmix_bu
 
     PMIX_HIDE_UNUSED_PARAMS(regtypes, type);
 
+    /* when only measuring, the bytes are never looked at */
+    if (buffer->measure) {
+        buffer->bytes_used += num_vals;
+        return PMIX_SUCCESS;
+    }
+
     /* check to see if buffer needs extending */
     if (NULL == (dst = pmix_bfrop_buffer_extend(buffer, num_vals))) {
         return PMIX_ERR_OUT_OF_RESOURCE;
@@ -215,8 +221,7 @@ pmix_status_t pmix_bfrops_base_pack_byte(pmix_pointer_array_t *regtypes, pmix_bu
 pmix_status_t pmix_bfrops_base_pack_int16(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                           const void *src, int32_t num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint16_t tmp, *srctmp = (uint16_t *) src;
+    uint16_t tmp;
     char *dst;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
@@ -229,11 +234,7 @@ pmix_status_t pmix_bfrops_base_pack_int16(pmix_pointer_array_t *regtypes, pmix_b
         return PMIX_ERR_OUT_OF_RESOURCE;
     }
 
-    for (i = 0; i < num_vals; ++i) {
-        tmp = pmix_htons(srctmp[i]);
-        memcpy(dst, &tmp, sizeof(tmp));
-        dst += sizeof(tmp);
-    }
+    pmix_bfrop_swap16_copy(dst, src, num_vals);
     buffer->pack_ptr += num_vals * sizeof(tmp);
     buffer->bytes_used += num_vals * sizeof(tmp);
 
@@ -246,8 +247,7 @@ pmix_status_t pmix_bfrops_base_pack_int16(pmix_pointer_array_t *regtypes, pmix_b
 pmix_status_t pmix_bfrops_base_pack_int32(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                           const void *src, int32_t num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint32_t tmp, *srctmp = (uint32_t *) src;
+    uint32_t tmp;
     char *dst;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
@@ -259,11 +259,7 @@ pmix_status_t pmix_bfrops_base_pack_int32(pmix_pointer_array_t *regtypes, pmix_b
     if (NULL == (dst = pmix_bfrop_buffer_extend(buffer, num_vals * sizeof(tmp)))) {
         return PMIX_ERR_OUT_OF_RESOURCE;
     }
-    for (i = 0; i < num_vals; ++i) {
-        tmp = htonl(srctmp[i]);
-        memcpy(dst, &tmp, sizeof(tmp));
-        dst += sizeof(tmp);
-    }
+    pmix_bfrop_swap32_copy(dst, src, num_vals);
     buffer->pack_ptr += num_vals * sizeof(tmp);
     buffer->bytes_used += num_vals * sizeof(tmp);
 
@@ -276,10 +272,8 @@ pmix_status_t pmix_bfrops_base_pack_int32(pmix_pointer_array_t *regtypes, pmix_b
 pmix_status_t pmix_bfrops_base_pack_int64(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                           const void *src, int32_t num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint64_t tmp, tmp2;
     char *dst;
-    size_t bytes_packed = num_vals * sizeof(tmp);
+    size_t bytes_packed = num_vals * sizeof(uint64_t);
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
                         "pmix_bfrops_base_pack_int64 * %d\n", num_vals);
@@ -291,12 +285,7 @@ pmix_status_t pmix_bfrops_base_pack_int64(pmix_pointer_array_t *regtypes, pmix_b
         return PMIX_ERR_OUT_OF_RESOURCE;
     }
 
-    for (i = 0; i < num_vals; ++i) {
-        memcpy(&tmp2, (char *) src + i * sizeof(uint64_t), sizeof(uint64_t));
-        tmp = pmix_hton64(tmp2);
-        memcpy(dst, &tmp, sizeof(tmp));
-        dst += sizeof(tmp);
-    }
+    pmix_bfrop_swap64_copy(dst, src, num_vals);
     buffer->pack_ptr += bytes_packed;
     buffer->bytes_used += bytes_packed;
 
@@ -312,23 +301,30 @@ pmix_status_t pmix_bfrops_base_pack_string(pmix_pointer_array_t *regtypes, pmix_
     int ret = PMIX_SUCCESS;
     int32_t i, len;
     char **ssrc = (char **) src;
+    pmix_bfrop_internal_pack_fn_t packlen, packbytes;
 
     PMIX_HIDE_UNUSED_PARAMS(type);
 
+    PMIX_BFROPS_PACK_FN(packlen, PMIX_INT32, regtypes);
+    PMIX_BFROPS_PACK_FN(packbytes, PMIX_BYTE, regtypes);
+    if (NULL == packlen || NULL == packbytes) {
+        return PMIX_ERR_UNKNOWN_DATA_TYPE;
+    }
+
     for (i = 0; i < num_vals; ++i) {
         if (NULL == ssrc[i]) { /* got zero-length string/NULL pointer - store NULL */
             len = 0;
-            PMIX_BFROPS_PACK_TYPE(ret, buffer, &len, 1, PMIX_INT32, regtypes);
+            ret = packlen(regtypes, buffer, &len, 1, PMIX_INT32);
             if (PMIX_SUCCESS != ret) {
                 return ret;
             }
         } else {
             len = (int32_t) strlen(ssrc[i]) + 1; // retain the NULL terminator
-            PMIX_BFROPS_PACK_TYPE(ret, buffer, &len, 1, PMIX_INT32, regtypes);
+            ret = packlen(regtypes, buffer, &len, 1, PMIX_INT32);
             if (PMIX_SUCCESS != ret) {
                 return ret;
             }
-            PMIX_BFROPS_PACK_TYPE(ret, buffer, ssrc[i], len, PMIX_BYTE, regtypes);
+            ret = packbytes(regtypes, buffer, ssrc[i], len, PMIX_BYTE);
             if (PMIX_SUCCESS != ret) {
                 return ret;
             }
@@ -523,18 +519,25 @@ pmix_status_t pmix_bfrops_base_pack_proc(pmix_pointer_array_t *regtypes, pmix_bu
     pmix_proc_t *proc;
     int32_t i;
     int ret;
+    pmix_bfrop_internal_pack_fn_t packnspace, packrank;
 
     PMIX_HIDE_UNUSED_PARAMS(type);
 
     proc = (pmix_proc_t *) src;
 
+    PMIX_BFROPS_PACK_FN(packnspace, PMIX_STRING, regtypes);
+    PMIX_BFROPS_PACK_FN(packrank, PMIX_PROC_RANK, regtypes);
+    if (NULL == packnspace || NULL == packrank) {
+        return PMIX_ERR_UNKNOWN_DATA_TYPE;
+    }
+
     for (i = 0; i < num_vals; ++i) {
         char *ptr = proc[i].nspace;
-        PMIX_BFROPS_PACK_TYPE(ret, buffer, &ptr, 1, PMIX_STRING, regtypes);
+        ret = packnspace(regtypes, buffer, &ptr, 1, PMIX_STRING);
         if (PMIX_SUCCESS != ret) {
             return ret;
         }
-        PMIX_BFROPS_PACK_TYPE(ret, buffer, &proc[i].rank, 1, PMIX_PROC_RANK, regtypes);
+        ret = packrank(regtypes, buffer, &proc[i].rank, 1, PMIX_PROC_RANK);
         if (PMIX_SUCCESS != ret) {
             return ret;
         }
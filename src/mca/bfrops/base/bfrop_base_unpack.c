@@ -304,8 +304,7 @@ pmix_status_t pmix_bfrops_base_unpack_byte(pmix_pointer_array_t *regtypes, pmix_
 pmix_status_t pmix_bfrops_base_unpack_int16(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                             void *dest, int32_t *num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint16_t tmp, *desttmp = (uint16_t *) dest;
+    uint16_t tmp;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
                         "pmix_bfrop_unpack_int16 * %d\n", (int) *num_vals);
@@ -318,12 +317,8 @@ pmix_status_t pmix_bfrops_base_unpack_int16(pmix_pointer_array_t *regtypes, pmix
     }
 
     /* unpack the data */
-    for (i = 0; i < (*num_vals); ++i) {
-        memcpy(&(tmp), buffer->unpack_ptr, sizeof(tmp));
-        tmp = pmix_ntohs(tmp);
-        memcpy(&desttmp[i], &tmp, sizeof(tmp));
-        buffer->unpack_ptr += sizeof(tmp);
-    }
+    pmix_bfrop_swap16_copy(dest, buffer->unpack_ptr, *num_vals);
+    buffer->unpack_ptr += (*num_vals) * sizeof(tmp);
 
     return PMIX_SUCCESS;
 }
@@ -331,8 +326,7 @@ pmix_status_t pmix_bfrops_base_unpack_int16(pmix_pointer_array_t *regtypes, pmix
 pmix_status_t pmix_bfrops_base_unpack_int32(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                             void *dest, int32_t *num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint32_t tmp, *desttmp = (uint32_t *) dest;
+    uint32_t tmp;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
                         "pmix_bfrop_unpack_int32 * %d\n", (int) *num_vals);
@@ -345,12 +339,8 @@ pmix_status_t pmix_bfrops_base_unpack_int32(pmix_pointer_array_t *regtypes, pmix
     }
 
     /* unpack the data */
-    for (i = 0; i < (*num_vals); ++i) {
-        memcpy(&(tmp), buffer->unpack_ptr, sizeof(tmp));
-        tmp = ntohl(tmp);
-        memcpy(&desttmp[i], &tmp, sizeof(tmp));
-        buffer->unpack_ptr += sizeof(tmp);
-    }
+    pmix_bfrop_swap32_copy(dest, buffer->unpack_ptr, *num_vals);
+    buffer->unpack_ptr += (*num_vals) * sizeof(tmp);
 
     return PMIX_SUCCESS;
 }
@@ -370,8 +360,7 @@ pmix_status_t pmix_bfrops_base_unpack_datatype(pmix_pointer_array_t *regtypes,
 pmix_status_t pmix_bfrops_base_unpack_int64(pmix_pointer_array_t *regtypes, pmix_buffer_t *buffer,
                                             void *dest, int32_t *num_vals, pmix_data_type_t type)
 {
-    int32_t i;
-    uint64_t tmp, *desttmp = (uint64_t *) dest;
+    uint64_t tmp;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
                         "pmix_bfrop_unpack_int64 * %d\n", (int) *num_vals);
@@ -384,12 +373,8 @@ pmix_status_t pmix_bfrops_base_unpack_int64(pmix_pointer_array_t *regtypes, pmix
     }
 
     /* unpack the data */
-    for (i = 0; i < (*num_vals); ++i) {
-        memcpy(&(tmp), buffer->unpack_ptr, sizeof(tmp));
-        tmp = pmix_ntoh64(tmp);
-        memcpy(&desttmp[i], &tmp, sizeof(tmp));
-        buffer->unpack_ptr += sizeof(tmp);
-    }
+    pmix_bfrop_swap64_copy(dest, buffer->unpack_ptr, *num_vals);
+    buffer->unpack_ptr += (*num_vals) * sizeof(tmp);
 
     return PMIX_SUCCESS;
 }
@@ -400,11 +385,18 @@ pmix_status_t pmix_bfrops_base_unpack_string(pmix_pointer_array_t *regtypes, pmi
     pmix_status_t ret;
     int32_t i, len, n = 1;
     char **sdest = (char **) dest;
+    pmix_bfrop_internal_unpack_fn_t unpacklen, unpackbytes;
 
     PMIX_HIDE_UNUSED_PARAMS(type);
 
+    PMIX_BFROPS_UNPACK_FN(unpacklen, PMIX_INT32, regtypes);
+    PMIX_BFROPS_UNPACK_FN(unpackbytes, PMIX_BYTE, regtypes);
+    if (NULL == unpacklen || NULL == unpackbytes) {
+        return PMIX_ERR_UNKNOWN_DATA_TYPE;
+    }
+
     for (i = 0; i < (*num_vals); ++i) {
-        PMIX_BFROPS_UNPACK_TYPE(ret, buffer, &len, &n, PMIX_INT32, regtypes);
+        ret = unpacklen(regtypes, buffer, &len, &n, PMIX_INT32);
         if (PMIX_SUCCESS != ret) {
             return ret;
         }
@@ -415,7 +407,7 @@ pmix_status_t pmix_bfrops_base_unpack_string(pmix_pointer_array_t *regtypes, pmi
             if (NULL == sdest[i]) {
                 return PMIX_ERR_OUT_OF_RESOURCE;
             }
-            PMIX_BFROPS_UNPACK_TYPE(ret, buffer, sdest[i], &len, PMIX_BYTE, regtypes);
+            ret = unpackbytes(regtypes, buffer, sdest[i], &len, PMIX_BYTE);
             if (PMIX_SUCCESS != ret) {
                 return ret;
             }
@@ -889,6 +881,7 @@ pmix_status_t pmix_bfrops_base_unpack_proc(pmix_pointer_array_t *regtypes, pmix_
     int32_t i, n, m;
     pmix_status_t ret;
     char *tmp;
+    pmix_bfrop_internal_unpack_fn_t unpacknspace, unpackrank;
 
     pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
                         "pmix_bfrop_unpack: %d procs", *num_vals);
@@ -898,14 +891,18 @@ pmix_status_t pmix_bfrops_base_unpack_proc(pmix_pointer_array_t *regtypes, pmix_
     ptr = (pmix_proc_t *) dest;
     n = *num_vals;
 
+    PMIX_BFROPS_UNPACK_FN(unpacknspace, PMIX_STRING, regtypes);
+    PMIX_BFROPS_UNPACK_FN(unpackrank, PMIX_PROC_RANK, regtypes);
+    if (NULL == unpacknspace || NULL == unpackrank) {
+        return PMIX_ERR_UNKNOWN_DATA_TYPE;
+    }
+
     for (i = 0; i < n; ++i) {
-        pmix_output_verbose(20, pmix_bfrops_base_framework.framework_output,
-                            "pmix_bfrop_unpack: init proc[%d]", i);
         memset(&ptr[i], 0, sizeof(pmix_proc_t));
         /* unpack nspace */
         m = 1;
         tmp = NULL;
-        PMIX_BFROPS_UNPACK_TYPE(ret, buffer, &tmp, &m, PMIX_STRING, regtypes);
+        ret = unpacknspace(regtypes, buffer, &tmp, &m, PMIX_STRING);
         if (PMIX_SUCCESS != ret) {
             return ret;
         }
@@ -917,7 +914,7 @@ pmix_status_t pmix_bfrops_base_unpack_proc(pmix_pointer_array_t *regtypes, pmix_
         free(tmp);
         /* unpack the rank */
         m = 1;
-        PMIX_BFROPS_UNPACK_TYPE(ret, buffer, &ptr[i].rank, &m, PMIX_PROC_RANK, regtypes);
+        ret = unpackrank(regtypes, buffer, &ptr[i].rank, &m, PMIX_PROC_RANK);
         if (PMIX_SUCCESS != ret) {
             return ret;
         }
@@ -371,6 +371,29 @@ PMIX_EXPORT pmix_bfrops_module_t *pmix_bfrops_base_assign_module(const char *ver
 /* provide a backdoor to access the framework debug output */
 PMIX_EXPORT extern int pmix_bfrops_base_output;
 
+/* make room for at least the given number of bytes to be packed
+ * into a buffer without it having to grow */
+PMIX_EXPORT pmix_status_t pmix_bfrops_base_reserve(pmix_buffer_t *buffer, size_t bytes);
+
+/* blocks smaller than this are simply copied into the buffer
+ * by pmix_bfrops_base_attach */
+#define PMIX_BFROPS_ATTACH_MIN (16 * 1024)
+
+/* append a block of memory to the payload of a buffer by reference.
+ * The block is not copied - it is written out in place when the
+ * buffer is sent, and relfn(relcbd) is called once the buffer no
+ * longer needs it. Ownership of the block passes to the buffer even
+ * if an error is returned. The referenced bytes are NOT visible to
+ * unpack, unload or copy_payload - only the ptl send path walks them,
+ * so anything else must call pmix_bfrops_base_flatten first */
+PMIX_EXPORT pmix_status_t pmix_bfrops_base_attach(pmix_buffer_t *buffer, char *bytes,
+                                                  size_t size, pmix_release_cbfunc_t relfn,
+                                                  void *relcbd);
+
+/* pull any referenced blocks into the buffer itself so its
+ * payload is contiguous */
+PMIX_EXPORT pmix_status_t pmix_bfrops_base_flatten(pmix_buffer_t *buffer);
+
 /* MACROS FOR EXECUTING BFROPS FUNCTIONS */
 #define PMIX_BFROPS_ASSIGN_TYPE(p, b) (b)->type = (p)->nptr->compat.type
 
@@ -389,6 +412,27 @@ PMIX_EXPORT extern int pmix_bfrops_base_output;
         }                                                                                    \
     } while (0)
 
+/* compute the number of bytes that packing the given data for
+ * the peer would add to a buffer, without keeping the packed data.
+ * Strings, byte objects and other raw bytes are only counted, not
+ * copied. Callers can use this with PMIX_BFROPS_RESERVE to size a
+ * buffer once rather than growing it as they pack */
+#define PMIX_BFROPS_PACK_SIZE(r, p, s, n, t, sz) \
+    do {                                         \
+        pmix_buffer_t __bkt;                     \
+        PMIX_CONSTRUCT(&__bkt, pmix_buffer_t);   \
+        __bkt.measure = true;                    \
+        PMIX_BFROPS_PACK(r, p, &__bkt, s, n, t); \
+        (sz) = __bkt.bytes_used;                 \
+        PMIX_DESTRUCT(&__bkt);                   \
+    } while (0)
+
+#define PMIX_BFROPS_RESERVE(r, b, sz) \
+    (r) = pmix_bfrops_base_reserve(b, sz)
+
+#define PMIX_BFROPS_ATTACH(r, b, d, sz, fn, cbd) \
+    (r) = pmix_bfrops_base_attach(b, d, sz, fn, cbd)
+
 #define PMIX_BFROPS_UNPACK(r, p, b, d, m, t)                                                   \
     do {                                                                                       \
         pmix_output_verbose(2, pmix_bfrops_base_output, "[%s:%d] UNPACK version %s type %s",   \
@@ -86,6 +86,20 @@ PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_kval_t);
         }                                                               \
     } while (0)
 
+/* a block of memory that goes out as part of a buffer's payload,
+ * starting at the given offset within the packed data, without
+ * being copied into the buffer. The release function is called
+ * when the buffer is done with it (see pmix_bfrops_base_attach) */
+typedef struct {
+    pmix_list_item_t super;
+    size_t offset;
+    char *bytes;
+    size_t size;
+    pmix_release_cbfunc_t relfn;
+    void *relcbd;
+} pmix_buffer_ref_t;
+PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_buffer_ref_t);
+
 /**
  * Structure for holding a buffer */
 typedef struct {
@@ -107,6 +121,14 @@ typedef struct {
     /** Number of bytes used by the buffer (i.e., amount of data --
         including overhead -- packed in the buffer) */
     size_t bytes_used;
+    /** Only count the bytes packed - the data itself is discarded
+        (see PMIX_BFROPS_PACK_SIZE) */
+    bool measure;
+    /** Blocks referenced rather than copied into the payload, in
+        order of their offsets - NULL if there are none */
+    pmix_list_t *refs;
+    /** Total number of bytes in the referenced blocks */
+    size_t ref_bytes;
 } pmix_buffer_t;
 PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_buffer_t);
 
@@ -176,6 +198,10 @@ PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_buffer_t);
  * exposing the internals */
 #define PMIX_BUFFER_IS_EMPTY(b) (0 == (b)->bytes_used || (b)->pack_ptr == (b)->unpack_ptr)
 
+/* Number of bytes the buffer puts on the wire, including any
+ * blocks it references rather than holds */
+#define PMIX_BUFFER_PAYLOAD_SIZE(b) ((b)->bytes_used + (b)->ref_bytes)
+
 END_C_DECLS
 
 #endif /* PMIX_BFROP_TYPES_H */
@@ -213,6 +213,12 @@ pmix_status_t pmix20_bfrop_pack_byte(pmix_pointer_array_t *regtypes, pmix_buffer
 
     PMIX_HIDE_UNUSED_PARAMS(regtypes, type);
 
+    /* when only measuring, the bytes are never looked at */
+    if (buffer->measure) {
+        buffer->bytes_used += num_vals;
+        return PMIX_SUCCESS;
+    }
+
     /* check to see if buffer needs extending */
     if (NULL == (dst = pmix_bfrop_buffer_extend(buffer, num_vals))) {
         return PMIX_ERR_OUT_OF_RESOURCE;
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2004-2008 The Trustees of Indiana University and Indiana
+ *                         University Research and Technology
+ *                         Corporation.  All rights reserved.
+ * Copyright (c) 2004-2006 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * Copyright (c) 2004-2005 High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ * Copyright (c) 2004-2005 The Regents of the University of California.
+ *                         All rights reserved.
+ * Copyright (c) 2016-2019 Intel, Inc.  All rights reserved.
+ * Copyright (c) 2021-2022 Nanook Consulting.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#ifndef PMIX_BFROPS_V5COMPACT_H
+#define PMIX_BFROPS_V5COMPACT_H
+
+#include "src/mca/bfrops/bfrops.h"
+
+BEGIN_C_DECLS
+
+/* The v5compact wire format is the v41 format - with every integer,
+ * count, length and type tag run through psquash - plus:
+ *
+ * - ranks are offset by PMIX_V5COMPACT_RANK_BIAS before encoding so
+ *   the reserved values (WILDCARD, UNDEF, ...) that sit at the very
+ *   top of the range take a single byte instead of five
+ *
+ * - arrays of more than one pmix_proc_t are sent as runs: the nspace
+ *   (a NULL string if it is the same as that of the previous run),
+ *   the first rank, and the number of procs in the run, whose ranks
+ *   are contiguous. A single proc is sent as just its nspace and rank
+ */
+#define PMIX_V5COMPACT_RANK_BIAS 8
+
+/* the component must be visible data for the linker to find it */
+PMIX_EXPORT extern pmix_bfrops_base_component_t pmix_mca_bfrops_v5compact_component;
+
+extern pmix_bfrops_module_t pmix_bfrops_v5compact_module;
+
+END_C_DECLS
+
+#endif /* PMIX_BFROPS_V5COMPACT_H */
@@ -516,6 +516,8 @@ static pmix_status_t register_info(pmix_peer_t *peer,
     pmix_list_t results;
     char *hname;
     pmix_session_t *sptr;
+    size_t sz;
+    bool reserved = false;
 
     pmix_output_verbose(2, pmix_gds_base_framework.framework_output,
                         "REGISTERING FOR PEER %s type %d.%d.%d",
@@ -624,7 +626,10 @@ static pmix_status_t register_info(pmix_peer_t *peer,
     }
     PMIX_LIST_DESTRUCT(&results);
 
-    /* get the proc-level data for each proc in the job */
+    /* get the proc-level data for each proc in the job. The blobs
+     * of a job are all about the same size, so once the first one
+     * is in the reply we can make room for the rest at once rather
+     * than growing the reply as each is added */
     pmix_output_verbose(2, pmix_gds_base_framework.framework_output,
                         "FETCHING PROC INFO FOR NSPACE %s NPROCS %u", ns->nspace, ns->nprocs);
     for (rank = 0; rank < ns->nprocs; rank++) {
@@ -652,10 +657,21 @@ static pmix_status_t register_info(pmix_peer_t *peer,
         kv.value = &blob;
         blob.type = PMIX_BYTE_OBJECT;
         PMIX_UNLOAD_BUFFER(&buf, blob.data.bo.bytes, blob.data.bo.size);
+        sz = PMIX_BUFFER_PAYLOAD_SIZE(reply);
         PMIX_BFROPS_PACK(rc, peer, reply, &kv, 1, PMIX_KVAL);
         PMIX_VALUE_DESTRUCT(&blob);
         PMIX_DESTRUCT(&buf);
+        if (!reserved) {
+            sz = PMIX_BUFFER_PAYLOAD_SIZE(reply) - sz;
+            PMIX_BFROPS_RESERVE(rc, reply, sz * (ns->nprocs - rank - 1));
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                return rc;
+            }
+            reserved = true;
+        }
     }
+
     return rc;
 }
 
@@ -757,7 +773,7 @@ static pmix_status_t hash_store_job_info(const char *nspace, pmix_buffer_t *buf)
     pmix_hash_table_t *ht;
     char **nodelist = NULL;
     pmix_nodeinfo_t *nd;
-    pmix_namespace_t *ns, *nptr;
+    pmix_namespace_t *nptr;
     pmix_info_t *iptr;
     pmix_session_t *s = NULL;
     pmix_apptrkr_t *apptr;
@@ -781,13 +797,7 @@ static pmix_status_t hash_store_job_info(const char *nspace, pmix_buffer_t *buf)
     ht = &trk->internal;
 
     /* retrieve the nspace pointer */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(ns->nspace, nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(nspace);
     if (NULL == nptr) {
         /* only can happen if we are out of mem */
         return PMIX_ERR_NOMEM;
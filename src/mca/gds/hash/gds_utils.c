@@ -54,7 +54,7 @@
 pmix_job_t *pmix_gds_hash_get_tracker(const pmix_nspace_t nspace, bool create)
 {
     pmix_job_t *trk, *t;
-    pmix_namespace_t *ns, *nptr;
+    pmix_namespace_t *nptr;
 
     /* find the hash table for this nspace */
     trk = NULL;
@@ -69,13 +69,7 @@ pmix_job_t *pmix_gds_hash_get_tracker(const pmix_nspace_t nspace, bool create)
         trk = PMIX_NEW(pmix_job_t);
         trk->ns = strdup(nspace);
         /* see if we already have this nspace */
-        nptr = NULL;
-        PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-            if (0 == strcmp(ns->nspace, nspace)) {
-                nptr = ns;
-                break;
-            }
-        }
+        nptr = pmix_nspace_lookup(nspace);
         if (NULL == nptr) {
             nptr = PMIX_NEW(pmix_namespace_t);
             if (NULL == nptr) {
@@ -83,7 +77,7 @@ pmix_job_t *pmix_gds_hash_get_tracker(const pmix_nspace_t nspace, bool create)
                 return NULL;
             }
             nptr->nspace = strdup(nspace);
-            pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+            pmix_nspace_add(nptr);
         }
         PMIX_RETAIN(nptr);
         trk->nptr = nptr;
@@ -18,6 +18,7 @@
 #include "gds_shmem_utils.h"
 #include "gds_shmem_store.h"
 #include "gds_shmem_fetch.h"
+#include "gds_shmem_arena.h"
 // TODO(skg) This will eventually go away.
 #include "pmix_hash2.h"
 
@@ -50,6 +51,7 @@
 #ifdef HAVE_TIME_H
 #include <time.h>
 #endif
+#include <sys/mman.h>
 
 // Some notes:
 // We cannot use PMIX_CONSTRUCT for data that are stored in shared memory
@@ -68,6 +70,9 @@
 #define PMIX_GDS_SHMEM_KEY_SEG_PATH "PMIX_GDS_SHMEM_SEG_PATH"
 #define PMIX_GDS_SHMEM_KEY_SEG_SIZE "PMIX_GDS_SHMEM_SEG_SIZE"
 #define PMIX_GDS_SHMEM_KEY_SEG_ADDR "PMIX_GDS_SHMEM_SEG_ADDR"
+#define PMIX_GDS_SHMEM_KEY_MODEX_SEG_PATH "PMIX_GDS_SHMEM_MODEX_SEG_PATH"
+#define PMIX_GDS_SHMEM_KEY_MODEX_SEG_SIZE "PMIX_GDS_SHMEM_MODEX_SEG_SIZE"
+#define PMIX_GDS_SHMEM_KEY_MODEX_SEG_ADDR "PMIX_GDS_SHMEM_MODEX_SEG_ADDR"
 
 /**
  * String to size_t.
@@ -98,117 +103,6 @@ strtost(
     return PMIX_SUCCESS;
 }
 
-/**
- * 8-byte address alignment.
- */
-static inline void *
-addr_align_8(
-    void *base,
-    size_t size
-) {
-#if 0 // Helpful debug
-    PMIX_GDS_SHMEM_VOUT("------------------------ADDRINN=%p,%zd", base, size);
-#endif
-    void *result = (void *)(((uintptr_t)base + size + 7) & ~(uintptr_t)0x07);
-#if 0 // Helpful debug
-    // Make sure that it's 8-byte aligned.
-    assert ((uintptr_t)result % 8 == 0);
-    PMIX_GDS_SHMEM_VOUT("------------------------ADDROUT=%p,%zd", result, size);
-#endif
-    return result;
-}
-
-// TODO(skg) Add memory arena boundary checks.
-static inline void *
-tma_malloc(
-    pmix_tma_t *tma,
-    size_t size
-) {
-    void *current = *(tma->data_ptr);
-    memset(current, 0, size);
-    *(tma->data_ptr) = addr_align_8(current, size);
-    return current;
-}
-
-// TODO(skg) Add memory arena boundary checks.
-static inline void *
-tma_calloc(
-    struct pmix_tma *tma,
-    size_t nmemb,
-    size_t size
-) {
-    const size_t real_size = nmemb * size;
-    void *current = *(tma->data_ptr);
-    memset(current, 0, real_size);
-    *(tma->data_ptr) = addr_align_8(current, real_size);
-    return current;
-}
-
-// TODO(skg)
-static inline void *
-tma_realloc(
-    pmix_tma_t *tma,
-    void *ptr,
-    size_t size
-) {
-    PMIX_HIDE_UNUSED_PARAMS(tma, ptr, size);
-    assert(false);
-    return NULL;
-}
-
-// TODO(skg) Add memory arena boundary checks.
-static inline char *
-tma_strdup(
-    pmix_tma_t *tma,
-    const char *s
-) {
-    void *current = *(tma->data_ptr);
-    const size_t size = strlen(s) + 1;
-    *(tma->data_ptr) = addr_align_8(current, size);
-    return (char *)memmove(current, s, size);
-}
-
-// TODO(skg) Add memory arena boundary checks.
-static inline void *
-tma_memmove(
-    struct pmix_tma *tma,
-    const void *src,
-    size_t size
-) {
-    void *current = *(tma->data_ptr);
-    *(tma->data_ptr) = addr_align_8(current, size);
-    return memmove(current, src, size);
-}
-
-// TODO(skg)
-static inline void
-tma_free(
-    struct pmix_tma *tma,
-    void *ptr
-) {
-    PMIX_HIDE_UNUSED_PARAMS(tma, ptr);
-}
-
-static void
-tma_init_function_pointers(
-    pmix_tma_t *tma
-) {
-    tma->tma_malloc = tma_malloc;
-    tma->tma_calloc = tma_calloc;
-    tma->tma_realloc = tma_realloc;
-    tma->tma_strdup = tma_strdup;
-    tma->tma_memmove = tma_memmove;
-    tma->tma_free = tma_free;
-}
-
-static void
-tma_init(
-    pmix_tma_t *tma
-) {
-    tma_init_function_pointers(tma);
-    tma->data_ptr = NULL;
-}
-
 static void
 host_alias_construct(
     pmix_gds_shmem_host_alias_t *a
@@ -276,6 +170,10 @@ job_construct(
     job->ffgds = NULL;
     job->shmem = PMIX_NEW(pmix_shmem_t);
     job->smdata = NULL;
+    job->modex_shmem = PMIX_NEW(pmix_shmem_t);
+    job->modex_smdata = NULL;
+    PMIX_CONSTRUCT(&job->chained, pmix_pointer_array_t);
+    pmix_pointer_array_init(&job->chained, 4, INT_MAX, 4);
 }
 
 static void
@@ -289,12 +187,25 @@ job_destruct(
         PMIX_RELEASE(job->nspace);
     }
     job->ffgds = NULL;
+    // Segments chained on by the arena go first.
+    for (int i = 0; i < job->chained.size; i++) {
+        pmix_shmem_t *seg = pmix_pointer_array_get_item(&job->chained, i);
+        if (NULL != seg) {
+            PMIX_RELEASE(seg);
+        }
+    }
+    PMIX_DESTRUCT(&job->chained);
     // This will release the memory for the structures located in the
     // shared-memory segment.
     if (job->shmem) {
         PMIX_RELEASE(job->shmem);
     }
     job->shmem = NULL;
+    if (job->modex_shmem) {
+        PMIX_RELEASE(job->modex_shmem);
+    }
+    job->modex_shmem = NULL;
+    job->modex_smdata = NULL;
 }
 
 PMIX_CLASS_INSTANCE(
@@ -383,14 +294,10 @@ assign_module(
             break;
         }
     }
-#if (PMIX_GDS_SHMEM_DISABLE == 1)
-    if (true) {
-        *priority = 0;
-        return PMIX_SUCCESS;
-    }
-#endif
-    // If they don't want us, then disqualify ourselves.
-    if (specified && *priority != max_priority) {
+    // If they don't want us, then disqualify ourselves. Without a list from
+    // the server we also cannot tell whether the job is large enough to
+    // benefit from us (see server_setup_fork()), so defer to the others.
+    if (!specified || *priority != max_priority) {
         *priority = 0;
         return PMIX_SUCCESS;
     }
@@ -468,7 +375,7 @@ prepare_backing_store_for_local_job_data(
     }
     // Create and attach to the shared-memory segment.
     rc = pmix_gds_shmem_segment_create_and_attach(
-        job, segment_name, seg_size
+        job->shmem, segment_name, seg_size
     );
     if (PMIX_SUCCESS != rc) {
         return rc;
@@ -479,14 +386,12 @@ prepare_backing_store_for_local_job_data(
     void *baseaddr = job->shmem->base_address;
     job->smdata = baseaddr;
     memset(job->smdata, 0, sizeof(*job->smdata));
-    // Save the starting address for TMA memory allocations.
-    job->smdata->current_addr = baseaddr;
-    // Setup the TMA.
-    tma_init(&job->smdata->tma);
-    job->smdata->tma.data_ptr = &job->smdata->current_addr;
-    // Now we need to update the TMA's pointer to account for our using up some
-    // space for its header.
-    *(job->smdata->tma.data_ptr) = addr_align_8(baseaddr, sizeof(*job->smdata));
+    // Setup the TMA. Its arena starts just past the header.
+    pmix_gds_shmem_arena_init(
+        &job->smdata->tma, &job->smdata->arena,
+        (char *)baseaddr + sizeof(*job->smdata),
+        (char *)baseaddr + job->shmem->size
+    );
     // We can now safely get the job's TMA.
     pmix_tma_t *tma = pmix_gds_shmem_get_job_tma(job);
     // Now that we know the TMA, allocate its structures.
@@ -501,26 +406,90 @@ prepare_backing_store_for_local_job_data(
     return rc;
 }
 
-static inline pmix_status_t
-pack_shmem_connection_info(
-    pmix_gds_shmem_job_t *job,
-    pmix_peer_t *peer,
-    pmix_buffer_t *buffer
+/**
+ * Creates the segment that will hold the job's modex data. Its size cannot be
+ * known until the data arrive, so reserve a per-rank budget up front. Pages
+ * that are never written do not consume memory.
+ */
+static pmix_status_t
+prepare_backing_store_for_modex_data(
+    pmix_gds_shmem_job_t *job
 ) {
     pmix_status_t rc = PMIX_SUCCESS;
+    const size_t nranks = (size_t)job->nspace->nprocs;
+    const size_t per_rank = pmix_mca_gds_shmem_component.modex_size_per_proc;
 
+    if (job->modex_smdata) {
+        return PMIX_SUCCESS;
+    }
+    // Without a job size or a budget there is nothing we can index,
+    // so leave all modex data to the full-featured gds module.
+    if (0 == nranks || 0 == per_rank) {
+        return PMIX_SUCCESS;
+    }
+    size_t seg_size = sizeof(pmix_gds_shmem_modex_data_t);
+    seg_size += nranks * (sizeof(pmix_list_t *) + sizeof(pmix_list_t));
+    seg_size += nranks * per_rank;
+    seg_size += pmix_gds_shmem_pad_amount_to_page(seg_size);
+
+    char segment_name[PMIX_PATH_MAX] = {'\0'};
+    size_t nw = snprintf(
+        segment_name, PMIX_PATH_MAX, "%s-modex", job->nspace_id
+    );
+    if (nw >= PMIX_PATH_MAX) {
+        rc = PMIX_ERROR;
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    rc = pmix_gds_shmem_segment_create_and_attach(
+        job->modex_shmem, segment_name, seg_size
+    );
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    // Same layout as the job segment: header first, then the TMA heap.
+    void *baseaddr = job->modex_shmem->base_address;
+    job->modex_smdata = baseaddr;
+    memset(job->modex_smdata, 0, sizeof(*job->modex_smdata));
+    pmix_gds_shmem_arena_init(
+        &job->modex_smdata->tma, &job->modex_smdata->arena,
+        (char *)baseaddr + sizeof(*job->modex_smdata),
+        (char *)baseaddr + job->modex_shmem->size
+    );
+    // Per-rank lists are created on first store.
+    job->modex_smdata->nranks = (pmix_rank_t)nranks;
+    job->modex_smdata->ranks = (pmix_list_t **)pmix_tma_calloc(
+        &job->modex_smdata->tma, nranks, sizeof(pmix_list_t *)
+    );
     PMIX_GDS_SHMEM_VOUT(
-        "%s:%s for peer (ID=%d) namespace=%s",
-        __func__, PMIX_NAME_PRINT(&pmix_globals.myid),
-        peer->info->peerid, job->nspace_id
+        "%s: modex segment for namespace=%s at %p (size=%zd B)",
+        __func__, job->nspace_id, baseaddr, seg_size
     );
+    return rc;
+}
+
+/**
+ * Packs the path, size, and base address needed to attach to the given segment
+ * under the provided key names.
+ */
+static pmix_status_t
+pack_shmem_segment_info(
+    pmix_shmem_t *shmem,
+    const char *path_key,
+    const char *size_key,
+    const char *addr_key,
+    pmix_peer_t *peer,
+    pmix_buffer_t *buffer
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+
     // Pack the backing file path.
     pmix_kval_t kv;
     PMIX_CONSTRUCT(&kv, pmix_kval_t);
-    kv.key = strdup(PMIX_GDS_SHMEM_KEY_SEG_PATH);
+    kv.key = strdup(path_key);
     kv.value = (pmix_value_t *)calloc(1, sizeof(pmix_value_t));
     kv.value->type = PMIX_STRING;
-    kv.value->data.string = strdup(job->shmem->backing_path);
+    kv.value->data.string = strdup(shmem->backing_path);
     PMIX_BFROPS_PACK(rc, peer, buffer, &kv, 1, PMIX_KVAL);
     PMIX_DESTRUCT(&kv);
     if (PMIX_SUCCESS != rc) {
@@ -529,10 +498,10 @@ pack_shmem_connection_info(
     }
     // Pack attach size to shared-memory segment.
     PMIX_CONSTRUCT(&kv, pmix_kval_t);
-    kv.key = strdup(PMIX_GDS_SHMEM_KEY_SEG_SIZE);
+    kv.key = strdup(size_key);
     kv.value = (pmix_value_t *)calloc(1, sizeof(pmix_value_t));
     kv.value->type = PMIX_STRING;
-    int nw = asprintf(&kv.value->data.string, "%zx", job->shmem->size);
+    int nw = asprintf(&kv.value->data.string, "%zx", shmem->size);
     if (nw == -1) {
         PMIX_DESTRUCT(&kv);
         return PMIX_ERR_NOMEM;
@@ -545,12 +514,12 @@ pack_shmem_connection_info(
     }
     // Pack the base address for attaching to shared-memory segment.
     PMIX_CONSTRUCT(&kv, pmix_kval_t);
-    kv.key = strdup(PMIX_GDS_SHMEM_KEY_SEG_ADDR);
+    kv.key = strdup(addr_key);
     kv.value = (pmix_value_t *)calloc(1, sizeof(pmix_value_t));
     kv.value->type = PMIX_STRING;
     nw = asprintf(
         &kv.value->data.string, "%zx",
-        (size_t)job->shmem->base_address
+        (size_t)shmem->base_address
     );
     if (nw == -1) {
         PMIX_DESTRUCT(&kv);
@@ -561,6 +530,42 @@ pack_shmem_connection_info(
     return rc;
 }
 
+static inline pmix_status_t
+pack_shmem_connection_info(
+    pmix_gds_shmem_job_t *job,
+    pmix_peer_t *peer,
+    pmix_buffer_t *buffer
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+
+    PMIX_GDS_SHMEM_VOUT(
+        "%s:%s for peer (ID=%d) namespace=%s",
+        __func__, PMIX_NAME_PRINT(&pmix_globals.myid),
+        peer->info->peerid, job->nspace_id
+    );
+    rc = pack_shmem_segment_info(
+        job->shmem,
+        PMIX_GDS_SHMEM_KEY_SEG_PATH,
+        PMIX_GDS_SHMEM_KEY_SEG_SIZE,
+        PMIX_GDS_SHMEM_KEY_SEG_ADDR,
+        peer, buffer
+    );
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    // The modex segment is optional.
+    if (!job->modex_smdata) {
+        return rc;
+    }
+    return pack_shmem_segment_info(
+        job->modex_shmem,
+        PMIX_GDS_SHMEM_KEY_MODEX_SEG_PATH,
+        PMIX_GDS_SHMEM_KEY_MODEX_SEG_SIZE,
+        PMIX_GDS_SHMEM_KEY_MODEX_SEG_ADDR,
+        peer, buffer
+    );
+}
+
 /**
  * Sets shared-memory connection information from a pmix_buffer_t by
  * unpacking the blob and saving the values for the appropriate rank.
@@ -613,6 +618,32 @@ unpack_shmem_connection_info(
             // Set job segment base address.
             job->shmem->base_address = (void *)base_addr;
         }
+        else if (pmix_gds_shmem_keys_eq(kval.key, PMIX_GDS_SHMEM_KEY_MODEX_SEG_PATH)) {
+            // Set modex segment path.
+            int nw = snprintf(
+                job->modex_shmem->backing_path, PMIX_PATH_MAX, "%s", val
+            );
+            if (nw >= PMIX_PATH_MAX) {
+                rc = PMIX_ERROR;
+                break;
+            }
+        }
+        else if (pmix_gds_shmem_keys_eq(kval.key, PMIX_GDS_SHMEM_KEY_MODEX_SEG_SIZE)) {
+            // Set modex shared-memory segment size.
+            rc = strtost(val, 16, &job->modex_shmem->size);
+            if (PMIX_SUCCESS != rc) {
+                break;
+            }
+        }
+        else if (pmix_gds_shmem_keys_eq(kval.key, PMIX_GDS_SHMEM_KEY_MODEX_SEG_ADDR)) {
+            size_t base_addr = 0;
+            rc = strtost(val, 16, &base_addr);
+            if (PMIX_SUCCESS != rc) {
+                break;
+            }
+            // Set modex segment base address.
+            job->modex_shmem->base_address = (void *)base_addr;
+        }
         else {
             rc = PMIX_ERR_BAD_PARAM;
             break;
@@ -694,6 +725,11 @@ register_job_info(
         PMIX_ERROR_LOG(rc);
         return rc;
     }
+    rc = prepare_backing_store_for_modex_data(job);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
 
     pmix_hash_table2_t *ht = job->smdata->local_hashtab;
     PMIX_LIST_FOREACH (kvi, &job_cb.kvs, pmix_kval_t) {
@@ -962,7 +998,14 @@ store_job_info(
     // structures from the shared-memory segment.
     job->smdata = job->shmem->base_address;
     // Update the TMA to point to its local function pointers.
-    tma_init_function_pointers(&job->smdata->tma);
+    pmix_gds_shmem_arena_init_function_pointers(&job->smdata->tma);
+    // Pick up any segments the server chained on while filling in the data.
+    rc = pmix_gds_shmem_arena_attach_chained(
+        job, job->shmem, &job->smdata->arena, false
+    );
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
     pmix_gds_shmem_vout_smdata(job);
     // Protect memory: clients can only read from here.
 #if 0
@@ -971,6 +1014,37 @@ store_job_info(
         job->shmem->size, PROT_READ
     );
 #endif
+    // Attach to the modex segment, if the server gave us one. Unlike the job
+    // segment, the server keeps adding to it after we attach.
+    if (0 != job->modex_shmem->size) {
+        rc = pmix_shmem_segment_attach(
+            job->modex_shmem,
+            job->modex_shmem->base_address,
+            &mmap_addr
+        );
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        if (mmap_addr != (uintptr_t)job->modex_shmem->base_address) {
+            rc = PMIX_ERROR;
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        job->modex_smdata = job->modex_shmem->base_address;
+        // Only the server writes modex data.
+        if (0 != mprotect(
+            job->modex_shmem->base_address,
+            job->modex_shmem->size, PROT_READ)) {
+            rc = PMIX_ERROR;
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        PMIX_GDS_SHMEM_VOUT(
+            "%s: modex segment mmapd at address=0x%zx", __func__,
+            (size_t)mmap_addr
+        );
+    }
     // Done. Before this point the server should have populated the
     // shared-memory segment with the relevant data.
     return rc;
@@ -992,10 +1066,75 @@ store(
         PMIX_ERROR_LOG(rc);
         return rc;
     }
+    // Remote data arriving at the server (e.g., a direct modex reply) goes
+    // into the modex segment so that our clients can read it directly.
+    if (PMIX_REMOTE == scope && NULL != job->modex_smdata &&
+        PMIX_PEER_IS_SERVER(pmix_globals.mypeer) &&
+        PMIX_RANK_IS_VALID(proc->rank)) {
+        rc = pmix_gds_shmem_store_modex_kval(job, proc->rank, kval);
+        if (PMIX_ERR_NOT_AVAILABLE != rc) {
+            return rc;
+        }
+    }
     // Let a full-featured gds module handle this.
     return job->ffgds->store(proc, scope, kval);
 }
 
+/**
+ * Stores the modex data unpacked for a single proc. The context is the job
+ * tracker of the namespace that ran the collective.
+ */
+static pmix_status_t
+store_modex_proc_data(
+    pmix_gds_base_ctx_t ctx,
+    pmix_proc_t *proc,
+    pmix_gds_modex_key_fmt_t key_fmt,
+    char **kmap,
+    pmix_buffer_t *pbkt
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+    pmix_gds_shmem_job_t *cjob = (pmix_gds_shmem_job_t *)ctx;
+    // The collective may span namespaces that we are not tracking.
+    pmix_gds_shmem_job_t *job = NULL;
+    (void)pmix_gds_shmem_get_job_tracker(proc->nspace, false, &job);
+    // Follow the hash component: data with an undefined
+    // rank is stored on rank 0, which must always exist.
+    pmix_proc_t target;
+    PMIX_LOAD_PROCID(
+        &target, proc->nspace,
+        (PMIX_RANK_UNDEF == proc->rank) ? 0 : proc->rank
+    );
+
+    pmix_kval_t kv;
+    PMIX_CONSTRUCT(&kv, pmix_kval_t);
+    rc = pmix_gds_base_modex_unpack_kval(key_fmt, pbkt, kmap, &kv);
+    while (PMIX_SUCCESS == rc) {
+        rc = PMIX_ERR_NOT_AVAILABLE;
+        if (NULL != job && NULL != job->modex_smdata) {
+            rc = pmix_gds_shmem_store_modex_kval(job, target.rank, &kv);
+        }
+        if (PMIX_ERR_NOT_AVAILABLE == rc) {
+            rc = cjob->ffgds->store(&target, PMIX_REMOTE, &kv);
+        }
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DESTRUCT(&kv);
+            return rc;
+        }
+        PMIX_DESTRUCT(&kv);
+        PMIX_CONSTRUCT(&kv, pmix_kval_t);
+        rc = pmix_gds_base_modex_unpack_kval(key_fmt, pbkt, kmap, &kv);
+    }
+    PMIX_DESTRUCT(&kv);
+    if (PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != rc) {
+        PMIX_ERROR_LOG(rc);
+    }
+    else {
+        rc = PMIX_SUCCESS;
+    }
+    return rc;
+}
+
 /**
  * This function is only called by the PMIx server when its host has received
  * data from some other peer. It therefore always contains data solely from
@@ -1018,8 +1157,34 @@ store_modex(
         PMIX_ERROR_LOG(rc);
         return rc;
     }
-    // Let a full-featured gds module handle this.
-    return job->ffgds->store_modex(nspace_struct, buff, cbdata);
+    // Without a modex segment, let a full-featured gds module handle this.
+    if (NULL == job->modex_smdata) {
+        return job->ffgds->store_modex(nspace_struct, buff, cbdata);
+    }
+    return pmix_gds_base_store_modex(
+        nspace_struct, buff, job, store_modex_proc_data, cbdata
+    );
+}
+
+/**
+ * Returns whether the given job is large enough for its clients to use us.
+ * Either threshold being met is enough.
+ */
+static bool
+use_shmem_for_job(
+    const pmix_namespace_t *ns
+) {
+    const unsigned int min_job_size = pmix_mca_gds_shmem_component.min_job_size;
+    const unsigned int min_local_procs = pmix_mca_gds_shmem_component.min_local_procs;
+
+    if (ns->nprocs >= min_job_size) {
+        return true;
+    }
+    // The host may not have told us how many procs are local.
+    if (SIZE_MAX != ns->nlocalprocs && ns->nlocalprocs >= min_local_procs) {
+        return true;
+    }
+    return false;
 }
 
 static pmix_status_t
@@ -1027,10 +1192,47 @@ server_setup_fork(
     const pmix_proc_t *peer,
     char ***env
 ) {
-    PMIX_HIDE_UNUSED_PARAMS(peer, env);
     PMIX_GDS_SHMEM_VOUT_HERE();
-    // Nothing to do here.
-    return PMIX_SUCCESS;
+
+    pmix_namespace_t *ns = pmix_nspace_lookup(peer->nspace);
+    // Unknown namespace, so keep what the server offered.
+    if (NULL == ns) {
+        return PMIX_SUCCESS;
+    }
+    if (use_shmem_for_job(ns)) {
+        return PMIX_SUCCESS;
+    }
+    // The job is too small for us: take ourselves out of the list of modules
+    // the client may choose from so that it selects one of the others.
+    char *offered = pmix_getenv("PMIX_GDS_MODULE", *env);
+    if (NULL == offered) {
+        return PMIX_SUCCESS;
+    }
+    char **options = pmix_argv_split(offered, ',');
+    char **remaining = NULL;
+    for (size_t m = 0; NULL != options && NULL != options[m]; m++) {
+        if (0 != strcmp(options[m], PMIX_GDS_SHMEM_NAME)) {
+            pmix_argv_append_nosize(&remaining, options[m]);
+        }
+    }
+    pmix_argv_free(options);
+    if (NULL == remaining) {
+        // We are all there is.
+        return PMIX_SUCCESS;
+    }
+    char *modules = pmix_argv_join(remaining, ',');
+    pmix_argv_free(remaining);
+    if (NULL == modules) {
+        return PMIX_ERR_NOMEM;
+    }
+    PMIX_GDS_SHMEM_VOUT(
+        "%s: namespace=%s nprocs=%u nlocalprocs=%zd is too small for us, "
+        "offering %s", __func__, ns->nspace, ns->nprocs,
+        ns->nlocalprocs, modules
+    );
+    pmix_status_t rc = pmix_setenv("PMIX_GDS_MODULE", modules, true, env);
+    free(modules);
+    return rc;
 }
 
 static pmix_status_t
@@ -19,6 +19,7 @@
 
 #include "src/class/pmix_object.h"
 #include "src/class/pmix_list.h"
+#include "src/class/pmix_pointer_array.h"
 
 #include "src/util/pmix_shmem.h"
 #include "src/util/pmix_vmem.h"
@@ -40,11 +41,6 @@
  */
 #define PMIX_GDS_SHMEM_NAME "shmem"
 
-/**
- * Set to 1 to completely disable this component.
- */
-#define PMIX_GDS_SHMEM_DISABLE 1
-
 /**
  * Defines a bitmask to track what information may not
  * have been provided but is computable from other info.
@@ -59,12 +55,19 @@
 /**
  * Default component/module priority.
  */
-#if (PMIX_GDS_SHMEM_DISABLE == 1)
-#define PMIX_GDS_SHMEM_DEFAULT_PRIORITY 0
-#else
 // We want to be just above hash's priority.
 #define PMIX_GDS_SHMEM_DEFAULT_PRIORITY 20
-#endif
+
+/**
+ * Number of power-of-two size classes kept by a shared-memory arena. Larger
+ * requests are served first-fit from a separate free list.
+ */
+#define PMIX_GDS_SHMEM_ARENA_NCLASSES 16
+
+/**
+ * Maximum number of segments an arena may chain once it runs out of room.
+ */
+#define PMIX_GDS_SHMEM_ARENA_MAX_CHAINED 16
 
 BEGIN_C_DECLS
 
@@ -74,6 +77,14 @@ typedef struct {
     pmix_gds_base_component_t super;
     /** List of jobs that I'm supporting. */
     pmix_list_t jobs;
+    /** Whether the component may be selected at all. */
+    bool enable;
+    /** Modex segment bytes reserved for each rank in a job. */
+    size_t modex_size_per_proc;
+    /** Smallest job for which clients are steered toward us. */
+    unsigned int min_job_size;
+    /** Smallest number of local procs for which clients are steered toward us. */
+    unsigned int min_local_procs;
 } pmix_gds_shmem_component_t;
 // The component must be visible data for the linker to find it.
 PMIX_EXPORT extern
@@ -99,6 +110,30 @@ typedef struct {
 } pmix_gds_shmem_nodeinfo_t;
 PMIX_CLASS_DECLARATION(pmix_gds_shmem_nodeinfo_t);
 
+typedef struct {
+    /** Size of the chained segment. */
+    size_t size;
+    /** Base address of the chained segment. */
+    void *base_address;
+} pmix_gds_shmem_arena_segment_t;
+
+// An arena lives in shared memory next to the structures it manages, so every
+// address it holds is valid in all processes attached to its segments.
+typedef struct {
+    /** Next available address. Must be first: the TMA's data_ptr points here. */
+    void *current_addr;
+    /** One past the last usable address in the current segment. */
+    void *end_addr;
+    /** Size-class free lists. */
+    void *free_lists[PMIX_GDS_SHMEM_ARENA_NCLASSES];
+    /** Free blocks larger than the largest size class. */
+    void *large_free;
+    /** Number of chained segments. */
+    uint32_t nchained;
+    /** Chained segments in order of creation. */
+    pmix_gds_shmem_arena_segment_t chained[PMIX_GDS_SHMEM_ARENA_MAX_CHAINED];
+} pmix_gds_shmem_arena_t;
+
 // Note that the shared data structures in pmix_gds_shmem_shared_data_t are
 // pointers. They need to be because their respective locations must reside on
 // the shared heap located in shared-memory and managed by the shared-memory
@@ -106,8 +141,8 @@ PMIX_CLASS_DECLARATION(pmix_gds_shmem_nodeinfo_t);
 typedef struct {
     /** Shared-memory allocator. */
     pmix_tma_t tma;
-    /** Holds the current address of the shared-memory allocator. */
-    void *current_addr;
+    /** Holds the state of the shared-memory allocator. */
+    pmix_gds_shmem_arena_t arena;
     /** Node information. */
     pmix_list_t *nodeinfo;
     /** List of applications in this job. */
@@ -118,6 +153,20 @@ typedef struct {
     pmix_list_t *jobinfo;
 } pmix_gds_shmem_shared_data_t;
 
+// Remote (modex) data are kept in a segment of their own because they arrive
+// after the job-level data have been handed to our clients. The server is the
+// only writer; clients map the segment read-only.
+typedef struct {
+    /** Shared-memory allocator. */
+    pmix_tma_t tma;
+    /** Holds the state of the shared-memory allocator. */
+    pmix_gds_shmem_arena_t arena;
+    /** Number of entries in ranks. */
+    pmix_rank_t nranks;
+    /** Per-rank lists of pmix_kval_t modex data, indexed by rank. */
+    pmix_list_t **ranks;
+} pmix_gds_shmem_modex_data_t;
+
 typedef struct {
     pmix_list_item_t super;
     /** Namespace identifier (name). */
@@ -130,6 +179,12 @@ typedef struct {
     pmix_shmem_t *shmem;
     /** Points to shared data located in shared-memory segment. */
     pmix_gds_shmem_shared_data_t *smdata;
+    /** Shared-memory object backing modex data. */
+    pmix_shmem_t *modex_shmem;
+    /** Points to modex data located in shared-memory segment. */
+    pmix_gds_shmem_modex_data_t *modex_smdata;
+    /** Chained arena segments attached by this process. */
+    pmix_pointer_array_t chained;
 } pmix_gds_shmem_job_t;
 PMIX_EXPORT PMIX_CLASS_DECLARATION(pmix_gds_shmem_job_t);
 
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2022      Triad National Security, LLC. All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// The arena backs the TMA used for data placed in shared memory. Only the
+// server allocates from it; clients attach to its segments and read.
+//
+// Every block is preceded by a small header holding its usable size. Requests
+// up to the largest size class are rounded up to a power of two and recycled
+// through per-class free lists. Larger requests are served first-fit from a
+// single list. When the current segment runs out of room, a new segment is
+// chained and allocation continues there.
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gds_shmem_arena.h"
+#include "gds_shmem_utils.h"
+
+#include "src/include/pmix_atomic.h"
+#include "src/util/pmix_error.h"
+#include "src/util/pmix_shmem.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+#include <sys/mman.h>
+
+/**
+ * Smallest block size. It must be able to hold a free-list link.
+ */
+#define ARENA_MIN_BLOCK 16
+
+typedef struct {
+    /** Usable size of the block in bytes. */
+    uint64_t size;
+} arena_block_t;
+
+static inline arena_block_t *
+block_of(
+    void *ptr
+) {
+    return (arena_block_t *)ptr - 1;
+}
+
+static inline pmix_gds_shmem_arena_t *
+arena_of(
+    pmix_tma_t *tma
+) {
+    // The TMA's data_ptr points at the first member of the arena.
+    return (pmix_gds_shmem_arena_t *)tma->data_ptr;
+}
+
+static inline size_t
+round_up_8(
+    size_t n
+) {
+    return (n + 7) & ~(size_t)0x07;
+}
+
+/**
+ * Returns the size class serving the given request and sets bsize to the block
+ * size to use. Returns -1 for requests larger than the largest class.
+ */
+static inline int
+size_class(
+    size_t size,
+    size_t *bsize
+) {
+    size_t c = ARENA_MIN_BLOCK;
+    for (int i = 0; i < PMIX_GDS_SHMEM_ARENA_NCLASSES; i++, c <<= 1) {
+        if (size <= c) {
+            *bsize = c;
+            return i;
+        }
+    }
+    *bsize = round_up_8(size);
+    return -1;
+}
+
+static pmix_status_t
+chained_path(
+    const pmix_shmem_t *primary,
+    uint32_t index,
+    char *path
+) {
+    int nw = snprintf(
+        path, PMIX_PATH_MAX, "%s.%u", primary->backing_path, index
+    );
+    if (nw < 0 || nw >= PMIX_PATH_MAX) {
+        return PMIX_ERROR;
+    }
+    return PMIX_SUCCESS;
+}
+
+/**
+ * Finds the job and primary segment that own the given arena.
+ */
+static pmix_status_t
+find_owner(
+    pmix_gds_shmem_arena_t *arena,
+    pmix_gds_shmem_job_t **job,
+    pmix_shmem_t **primary
+) {
+    pmix_gds_shmem_job_t *ji;
+    PMIX_LIST_FOREACH (ji, &pmix_mca_gds_shmem_component.jobs, pmix_gds_shmem_job_t) {
+        if (ji->smdata && &ji->smdata->arena == arena) {
+            *job = ji;
+            *primary = ji->shmem;
+            return PMIX_SUCCESS;
+        }
+        if (ji->modex_smdata && &ji->modex_smdata->arena == arena) {
+            *job = ji;
+            *primary = ji->modex_shmem;
+            return PMIX_SUCCESS;
+        }
+    }
+    return PMIX_ERR_NOT_FOUND;
+}
+
+/**
+ * Chains a new segment able to hold at least need bytes and makes it current.
+ */
+static pmix_status_t
+arena_grow(
+    pmix_gds_shmem_arena_t *arena,
+    size_t need
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+    pmix_gds_shmem_job_t *job = NULL;
+    pmix_shmem_t *primary = NULL;
+    char path[PMIX_PATH_MAX] = {'\0'};
+
+    if (PMIX_GDS_SHMEM_ARENA_MAX_CHAINED <= arena->nchained) {
+        return PMIX_ERR_OUT_OF_RESOURCE;
+    }
+    rc = find_owner(arena, &job, &primary);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    const uint32_t index = arena->nchained;
+    rc = chained_path(primary, index, path);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    // Grow by at least the size of the primary segment to keep chaining rare.
+    size_t size = (need > primary->size) ? need : primary->size;
+    size += pmix_gds_shmem_pad_amount_to_page(size);
+
+    pmix_shmem_t *seg = PMIX_NEW(pmix_shmem_t);
+    if (!seg) {
+        return PMIX_ERR_NOMEM;
+    }
+    rc = pmix_gds_shmem_segment_create_and_attach_path(seg, path, size);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_RELEASE(seg);
+        return rc;
+    }
+    if (0 > pmix_pointer_array_add(&job->chained, seg)) {
+        PMIX_RELEASE(seg);
+        return PMIX_ERR_NOMEM;
+    }
+    arena->chained[index].size = size;
+    arena->chained[index].base_address = seg->base_address;
+    // Readers must see the entry before they see the new count.
+    pmix_atomic_wmb();
+    arena->nchained = index + 1;
+    // Whatever is left at the end of the old segment is abandoned.
+    arena->current_addr = seg->base_address;
+    arena->end_addr = (char *)seg->base_address + size;
+
+    PMIX_GDS_SHMEM_VOUT(
+        "%s: chained segment %u for namespace=%s at %p (size=%zd B)",
+        __func__, index, job->nspace_id, seg->base_address, size
+    );
+    return PMIX_SUCCESS;
+}
+
+static void *
+arena_bump(
+    pmix_gds_shmem_arena_t *arena,
+    size_t bsize
+) {
+    const size_t need = sizeof(arena_block_t) + bsize;
+    char *current = arena->current_addr;
+    if ((size_t)((char *)arena->end_addr - current) < need) {
+        if (PMIX_SUCCESS != arena_grow(arena, need)) {
+            return NULL;
+        }
+        current = arena->current_addr;
+    }
+    arena->current_addr = current + need;
+    arena_block_t *block = (arena_block_t *)current;
+    block->size = bsize;
+    return block + 1;
+}
+
+static void *
+tma_malloc(
+    pmix_tma_t *tma,
+    size_t size
+) {
+    pmix_gds_shmem_arena_t *arena = arena_of(tma);
+    size_t bsize = 0;
+    void *ptr = NULL;
+
+    if (size > SIZE_MAX / 2) {
+        return NULL;
+    }
+    const int cls = size_class(size, &bsize);
+    if (0 <= cls) {
+        ptr = arena->free_lists[cls];
+        if (ptr) {
+            arena->free_lists[cls] = *(void **)ptr;
+        }
+    }
+    else {
+        void **prev = &arena->large_free;
+        for (void *b = *prev; NULL != b; prev = (void **)b, b = *(void **)b) {
+            if (block_of(b)->size >= bsize) {
+                *prev = *(void **)b;
+                ptr = b;
+                break;
+            }
+        }
+    }
+    if (ptr) {
+        // Callers expect zeroed memory, like that of a fresh segment.
+        memset(ptr, 0, size);
+        return ptr;
+    }
+    // Memory that has never been handed out is still zero-filled.
+    return arena_bump(arena, bsize);
+}
+
+static void *
+tma_calloc(
+    struct pmix_tma *tma,
+    size_t nmemb,
+    size_t size
+) {
+    if (0 != size && nmemb > SIZE_MAX / size) {
+        return NULL;
+    }
+    return tma_malloc(tma, nmemb * size);
+}
+
+static void
+tma_free(
+    struct pmix_tma *tma,
+    void *ptr
+) {
+    if (NULL == ptr) {
+        return;
+    }
+    pmix_gds_shmem_arena_t *arena = arena_of(tma);
+    size_t bsize = 0;
+    const int cls = size_class(block_of(ptr)->size, &bsize);
+    void **head = (0 <= cls) ? &arena->free_lists[cls] : &arena->large_free;
+    *(void **)ptr = *head;
+    *head = ptr;
+}
+
+static void *
+tma_realloc(
+    pmix_tma_t *tma,
+    void *ptr,
+    size_t size
+) {
+    if (NULL == ptr) {
+        return tma_malloc(tma, size);
+    }
+    if (0 == size) {
+        tma_free(tma, ptr);
+        return NULL;
+    }
+    const size_t bsize = block_of(ptr)->size;
+    if (size <= bsize) {
+        return ptr;
+    }
+    void *nptr = tma_malloc(tma, size);
+    if (NULL == nptr) {
+        return NULL;
+    }
+    memcpy(nptr, ptr, bsize);
+    tma_free(tma, ptr);
+    return nptr;
+}
+
+static char *
+tma_strdup(
+    pmix_tma_t *tma,
+    const char *s
+) {
+    const size_t size = strlen(s) + 1;
+    char *p = (char *)tma_malloc(tma, size);
+    if (NULL == p) {
+        return NULL;
+    }
+    return (char *)memcpy(p, s, size);
+}
+
+static void *
+tma_memmove(
+    struct pmix_tma *tma,
+    const void *src,
+    size_t size
+) {
+    void *p = tma_malloc(tma, size);
+    if (NULL == p) {
+        return NULL;
+    }
+    return memmove(p, src, size);
+}
+
+void
+pmix_gds_shmem_arena_init_function_pointers(
+    pmix_tma_t *tma
+) {
+    tma->tma_malloc = tma_malloc;
+    tma->tma_calloc = tma_calloc;
+    tma->tma_realloc = tma_realloc;
+    tma->tma_strdup = tma_strdup;
+    tma->tma_memmove = tma_memmove;
+    tma->tma_free = tma_free;
+}
+
+void
+pmix_gds_shmem_arena_init(
+    pmix_tma_t *tma,
+    pmix_gds_shmem_arena_t *arena,
+    void *start,
+    void *end
+) {
+    memset(arena, 0, sizeof(*arena));
+    arena->current_addr = (void *)round_up_8((uintptr_t)start);
+    arena->end_addr = end;
+    pmix_gds_shmem_arena_init_function_pointers(tma);
+    tma->data_ptr = &arena->current_addr;
+}
+
+bool
+pmix_gds_shmem_arena_reserve(
+    pmix_tma_t *tma,
+    size_t size,
+    size_t nallocs
+) {
+    pmix_gds_shmem_arena_t *arena = arena_of(tma);
+
+    if (size > SIZE_MAX / 4) {
+        return false;
+    }
+    // Worst case: every allocation is rounded up to the next size
+    // class, just short of doubling it, and carries a header.
+    const size_t need = 2 * size
+                      + nallocs * (sizeof(arena_block_t) + ARENA_MIN_BLOCK);
+    const size_t avail = (char *)arena->end_addr - (char *)arena->current_addr;
+    if (need <= avail) {
+        return true;
+    }
+    return PMIX_SUCCESS == arena_grow(arena, need);
+}
+
+static bool
+is_attached(
+    pmix_gds_shmem_job_t *job,
+    void *base_address
+) {
+    for (int i = 0; i < job->chained.size; i++) {
+        pmix_shmem_t *seg = pmix_pointer_array_get_item(&job->chained, i);
+        if (NULL != seg && seg->base_address == base_address) {
+            return true;
+        }
+    }
+    return false;
+}
+
+pmix_status_t
+pmix_gds_shmem_arena_attach_chained(
+    pmix_gds_shmem_job_t *job,
+    pmix_shmem_t *primary,
+    pmix_gds_shmem_arena_t *arena,
+    bool readonly
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+    const uint32_t nchained = arena->nchained;
+    // Pairs with the barrier in arena_grow().
+    pmix_atomic_rmb();
+
+    for (uint32_t i = 0; i < nchained; i++) {
+        void *base_address = arena->chained[i].base_address;
+        if (is_attached(job, base_address)) {
+            continue;
+        }
+        pmix_shmem_t *seg = PMIX_NEW(pmix_shmem_t);
+        if (!seg) {
+            return PMIX_ERR_NOMEM;
+        }
+        seg->size = arena->chained[i].size;
+        rc = chained_path(primary, i, seg->backing_path);
+        if (PMIX_SUCCESS == rc) {
+            uintptr_t mmap_addr = 0;
+            rc = pmix_shmem_segment_attach(seg, base_address, &mmap_addr);
+            if (PMIX_SUCCESS == rc && mmap_addr != (uintptr_t)base_address) {
+                rc = PMIX_ERROR;
+            }
+        }
+        if (PMIX_SUCCESS == rc && readonly &&
+            0 != mprotect(base_address, seg->size, PROT_READ)) {
+            rc = PMIX_ERROR;
+        }
+        if (PMIX_SUCCESS == rc &&
+            0 > pmix_pointer_array_add(&job->chained, seg)) {
+            rc = PMIX_ERR_NOMEM;
+        }
+        if (PMIX_SUCCESS != rc) {
+            // Do not let the destructor remove a file we do not own.
+            seg->backing_path[0] = '\0';
+            PMIX_RELEASE(seg);
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        PMIX_GDS_SHMEM_VOUT(
+            "%s: attached chained segment %u at %p", __func__,
+            i, base_address
+        );
+    }
+    return rc;
+}
+
+/*
+ * vim: ft=cpp ts=4 sts=4 sw=4 expandtab
+ */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2022      Triad National Security, LLC. All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+#ifndef PMIX_GDS_SHMEM_ARENA_H
+#define PMIX_GDS_SHMEM_ARENA_H
+
+#include "gds_shmem.h"
+
+BEGIN_C_DECLS
+
+/**
+ * Sets up the given TMA so that it allocates from an arena spanning the memory
+ * between start and end. Only the process that owns the segment (the server)
+ * should call this.
+ */
+PMIX_EXPORT void
+pmix_gds_shmem_arena_init(
+    pmix_tma_t *tma,
+    pmix_gds_shmem_arena_t *arena,
+    void *start,
+    void *end
+);
+
+/**
+ * Points the given TMA's functions at this process's arena implementation.
+ */
+PMIX_EXPORT void
+pmix_gds_shmem_arena_init_function_pointers(
+    pmix_tma_t *tma
+);
+
+/**
+ * Makes sure that nallocs allocations totaling size bytes can be served without
+ * failing part way through, chaining a new segment if needed. Returns false if
+ * the arena cannot grow any further.
+ */
+PMIX_EXPORT bool
+pmix_gds_shmem_arena_reserve(
+    pmix_tma_t *tma,
+    size_t size,
+    size_t nallocs
+);
+
+/**
+ * Attaches to any segments that the arena has chained since we last looked.
+ * The primary segment's backing path is used to derive theirs.
+ */
+PMIX_EXPORT pmix_status_t
+pmix_gds_shmem_arena_attach_chained(
+    pmix_gds_shmem_job_t *job,
+    pmix_shmem_t *primary,
+    pmix_gds_shmem_arena_t *arena,
+    bool readonly
+);
+
+END_C_DECLS
+
+#endif
+
+/*
+ * vim: ft=cpp ts=4 sts=4 sw=4 expandtab
+ */
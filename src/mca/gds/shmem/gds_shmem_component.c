@@ -30,6 +30,9 @@
 
 #include "gds_shmem.h"
 
+static pmix_status_t
+component_register(void);
+
 static int
 component_query(
     pmix_mca_base_module_t **module,
@@ -42,15 +45,17 @@ component_query(
         *module = NULL;
         return PMIX_ERROR;
     }
-#if (PMIX_GDS_SHMEM_DISABLE == 1)
-    *priority = PMIX_GDS_SHMEM_DEFAULT_PRIORITY;
-    *module = NULL;
-    return PMIX_ERROR;
-#else
+    // We are opt-in: only take part in selection when asked to. Clients
+    // of a server that selects us cannot yet attach to the job's segments
+    // (their job info fails to unpack), so we must not be the default.
+    if (!pmix_mca_gds_shmem_component.enable) {
+        *priority = 0;
+        *module = NULL;
+        return PMIX_ERROR;
+    }
     *priority = PMIX_GDS_SHMEM_DEFAULT_PRIORITY;
     *module = (pmix_mca_base_module_t *)&pmix_shmem_module;
     return PMIX_SUCCESS;
-#endif
 }
 
 /**
@@ -70,11 +75,55 @@ pmix_gds_shmem_component_t pmix_mca_gds_shmem_component = {
         ),
         /** Component query function. */
         .pmix_mca_query_component = component_query,
+        .pmix_mca_register_component_params = component_register,
         .reserved = {0}
     },
-    .jobs = PMIX_LIST_STATIC_INIT
+    .jobs = PMIX_LIST_STATIC_INIT,
+    .enable = false,
+    .modex_size_per_proc = 64 * 1024,
+    .min_job_size = 1024,
+    .min_local_procs = 64
 };
 
+static pmix_status_t
+component_register(void)
+{
+    (void)pmix_mca_base_component_var_register(
+        &pmix_mca_gds_shmem_component.super, "enable",
+        "Whether to make the shared-memory gds component available for "
+        "selection (default: false)",
+        PMIX_MCA_BASE_VAR_TYPE_BOOL,
+        &pmix_mca_gds_shmem_component.enable
+    );
+    // The modex segment is sparse, so only the pages actually
+    // written are backed by memory. Values that do not fit are
+    // kept by the full-featured gds module instead.
+    (void)pmix_mca_base_component_var_register(
+        &pmix_mca_gds_shmem_component.super, "modex_size_per_proc",
+        "Number of bytes of shared memory to reserve for each process's "
+        "modex data",
+        PMIX_MCA_BASE_VAR_TYPE_SIZE_T,
+        &pmix_mca_gds_shmem_component.modex_size_per_proc
+    );
+    // Small jobs do not have enough data to make up for the cost of
+    // setting up the segments, so leave them to the hash component.
+    (void)pmix_mca_base_component_var_register(
+        &pmix_mca_gds_shmem_component.super, "min_job_size",
+        "Minimum number of processes in a job for its clients to use "
+        "shared memory (0 = no minimum)",
+        PMIX_MCA_BASE_VAR_TYPE_UNSIGNED_INT,
+        &pmix_mca_gds_shmem_component.min_job_size
+    );
+    (void)pmix_mca_base_component_var_register(
+        &pmix_mca_gds_shmem_component.super, "min_local_procs",
+        "Minimum number of a job's processes on this node for its clients "
+        "to use shared memory (0 = no minimum)",
+        PMIX_MCA_BASE_VAR_TYPE_UNSIGNED_INT,
+        &pmix_mca_gds_shmem_component.min_local_procs
+    );
+    return PMIX_SUCCESS;
+}
+
 /*
  * vim: ft=cpp ts=4 sts=4 sw=4 expandtab
  */
@@ -16,6 +16,7 @@
 
 #include "gds_shmem_fetch.h"
 #include "gds_shmem_utils.h"
+#include "gds_shmem_arena.h"
 #if 0 // TODO(skg)
 #include "src/util/pmix_hash.h"
 #else
@@ -479,6 +480,104 @@ fetch_job_level_info_for_namespace(
 }
 #endif
 
+/**
+ * Attaches to any modex segments chained since nattached were seen. The server
+ * chains a segment before it publishes anything allocated from it, so calling
+ * this after reading a published pointer (and its read barrier) makes sure the
+ * memory that pointer refers to is mapped before we touch it.
+ */
+static pmix_status_t
+modex_attach_chained(
+    pmix_gds_shmem_job_t *job,
+    pmix_gds_shmem_modex_data_t *mdata,
+    uint32_t *nattached
+) {
+    const uint32_t nchained = mdata->arena.nchained;
+    if (nchained == *nattached) {
+        return PMIX_SUCCESS;
+    }
+    pmix_status_t rc = pmix_gds_shmem_arena_attach_chained(
+        job, job->modex_shmem, &mdata->arena, true
+    );
+    if (PMIX_SUCCESS == rc) {
+        *nattached = nchained;
+    }
+    return rc;
+}
+
+pmix_status_t
+pmix_gds_shmem_fetch_modex(
+    pmix_gds_shmem_job_t *job,
+    pmix_rank_t rank,
+    const char *key,
+    pmix_list_t *kvs
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+    pmix_gds_shmem_modex_data_t *mdata = job->modex_smdata;
+    bool found = false;
+
+    if (NULL == mdata || rank >= mdata->nranks) {
+        return PMIX_ERR_NOT_FOUND;
+    }
+    // The server may have chained on more memory since we last looked, and
+    // may chain more while we walk, so check again after every pointer read.
+    uint32_t nattached = UINT32_MAX;
+    pmix_list_t *rlist = mdata->ranks[rank];
+    if (NULL == rlist) {
+        return PMIX_ERR_NOT_FOUND;
+    }
+    // The entries live in shared memory, so hand back private copies. The
+    // server appends without a lock while we walk, so every pointer it
+    // publishes is read before a barrier that pairs with its write barrier
+    // in pmix_gds_shmem_store_modex_kval().
+    pmix_atomic_rmb();
+    rc = modex_attach_chained(job, mdata, &nattached);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    pmix_list_item_t *item;
+    for (item = pmix_list_get_first(rlist);
+         item != pmix_list_get_end(rlist);
+         item = pmix_list_get_next(item)) {
+        pmix_atomic_rmb();
+        rc = modex_attach_chained(job, mdata, &nattached);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        pmix_kval_t *kvi = (pmix_kval_t *)item;
+        if (NULL != key && !PMIX_CHECK_KEY(kvi, key)) {
+            continue;
+        }
+        pmix_value_t *value = kvi->value;
+        pmix_atomic_rmb();
+        rc = modex_attach_chained(job, mdata, &nattached);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        pmix_kval_t *kv = PMIX_NEW(pmix_kval_t);
+        if (NULL == kv) {
+            return PMIX_ERR_NOMEM;
+        }
+        kv->key = strdup(kvi->key);
+        kv->value = (pmix_value_t *)malloc(sizeof(pmix_value_t));
+        if (NULL == kv->value) {
+            PMIX_RELEASE(kv);
+            return PMIX_ERR_NOMEM;
+        }
+        PMIX_VALUE_XFER(rc, kv->value, value);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_RELEASE(kv);
+            return rc;
+        }
+        pmix_list_append(kvs, &kv->super);
+        found = true;
+        if (NULL != key) {
+            break;
+        }
+    }
+    return found ? PMIX_SUCCESS : PMIX_ERR_NOT_FOUND;
+}
+
 pmix_status_t
 pmix_gds_shmem_fetch(
     const pmix_proc_t *proc,
@@ -494,6 +593,7 @@ pmix_gds_shmem_fetch(
     bool appinfo = false;
     bool nigiven = false;
     bool apigiven = false;
+    bool has_qualifiers = false;
 
     PMIX_GDS_SHMEM_VOUT(
         "%s:%s key=%s for proc=%s on scope=%s",
@@ -517,6 +617,9 @@ pmix_gds_shmem_fetch(
     }
 
     for (size_t n = 0; n < nqual; n++) {
+        if (PMIX_INFO_IS_QUALIFIER(&qualifiers[n])) {
+            has_qualifiers = true;
+        }
         if (PMIX_CHECK_KEY(&qualifiers[n], PMIX_SESSION_INFO)) {
             // We don't handle session info, so pass it along.
             return job->ffgds->fetch(
@@ -606,6 +709,16 @@ doover:
     }
     else {
         rc = pmix_hash2_fetch(ht, proc->rank, key, qualifiers, nqual, kvs);
+        // Remote data for this rank may already be in the modex segment. A
+        // NULL key asks for everything, so add those values to any found
+        // above. We never store qualified values there, so skip it if asked.
+        if ((PMIX_SUCCESS != rc || NULL == key) && NULL != job->modex_smdata &&
+            PMIX_RANK_IS_VALID(proc->rank) && !has_qualifiers) {
+            if (PMIX_SUCCESS == pmix_gds_shmem_fetch_modex(
+                    job, proc->rank, key, kvs)) {
+                rc = PMIX_SUCCESS;
+            }
+        }
     }
     if (PMIX_SUCCESS != rc) {
         rc = job->ffgds->fetch(proc, scope, copy, key, qualifiers, nqual, kvs);
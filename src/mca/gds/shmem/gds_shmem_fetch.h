@@ -32,6 +32,18 @@ pmix_gds_shmem_fetch_appinfo(
     pmix_list_t *kvs
 );
 
+/**
+ * Fetches remote (modex) data for the given rank from the job's modex segment.
+ * A NULL key returns all values held for the rank.
+ */
+PMIX_EXPORT pmix_status_t
+pmix_gds_shmem_fetch_modex(
+    pmix_gds_shmem_job_t *job,
+    pmix_rank_t rank,
+    const char *key,
+    pmix_list_t *kvs
+);
+
 PMIX_EXPORT pmix_status_t
 pmix_gds_shmem_fetch(
     const pmix_proc_t *proc,
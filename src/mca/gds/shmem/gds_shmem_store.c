@@ -16,6 +16,7 @@
 
 #include "gds_shmem_store.h"
 #include "gds_shmem_utils.h"
+#include "gds_shmem_arena.h"
 // TODO(skg) This will eventually go away.
 #include "pmix_hash2.h"
 
@@ -25,6 +26,8 @@
 
 #include "src/mca/pmdl/pmdl.h"
 
+#include "src/include/pmix_atomic.h"
+
 /**
  * Populates the provided with the elements present in the given comma-delimited
  * string. If the list is not empty, it is first cleared and then set.
@@ -494,6 +497,131 @@ pmix_gds_shmem_store_job_array(
     return rc;
 }
 
+/**
+ * Appends an item to a list that clients walk without a lock. All of the
+ * item's links are set before a single store to the old tail's next pointer
+ * makes it reachable, so a reader following next pointers sees either the old
+ * end of the list or the complete new item.
+ */
+static void
+publish_list_item(
+    pmix_list_t *list,
+    pmix_list_item_t *item
+) {
+    pmix_list_item_t *sentinel = &list->pmix_list_sentinel;
+    pmix_list_item_t *last = (pmix_list_item_t *)sentinel->pmix_list_prev;
+
+    item->pmix_list_prev = last;
+    item->pmix_list_next = sentinel;
+#if PMIX_ENABLE_DEBUG
+    item->pmix_list_item_refcount += 1;
+    item->pmix_list_item_belong_to = list;
+#endif
+    // The item and everything it points to must be visible before it is.
+    pmix_atomic_wmb();
+    last->pmix_list_next = item;
+    sentinel->pmix_list_prev = item;
+    list->pmix_list_length++;
+}
+
+pmix_status_t
+pmix_gds_shmem_store_modex_kval(
+    pmix_gds_shmem_job_t *job,
+    pmix_rank_t rank,
+    pmix_kval_t *kval
+) {
+    pmix_status_t rc = PMIX_SUCCESS;
+    pmix_gds_shmem_modex_data_t *mdata = job->modex_smdata;
+    pmix_tma_t *tma = &mdata->tma;
+
+    if (NULL == kval->key || NULL == kval->value) {
+        return PMIX_ERR_BAD_PARAM;
+    }
+    // Only plain values for ranks we have slots for are kept here. Qualified
+    // values need the full-featured hash machinery. Data arrays are left out
+    // because we cannot bound their storage requirements ahead of time.
+    if (rank >= mdata->nranks ||
+        PMIX_CHECK_KEY(kval, PMIX_QUALIFIED_VALUE) ||
+        PMIX_DATA_ARRAY == kval->value->type) {
+        return PMIX_ERR_NOT_AVAILABLE;
+    }
+    // A later fence may update a value we already hold.
+    pmix_list_t *rlist = mdata->ranks[rank];
+    pmix_kval_t *existing = NULL;
+    if (NULL != rlist) {
+        pmix_kval_t *kvi;
+        PMIX_LIST_FOREACH (kvi, rlist, pmix_kval_t) {
+            if (PMIX_CHECK_KEY(kvi, kval->key)) {
+                existing = kvi;
+                break;
+            }
+        }
+    }
+    if (NULL != existing &&
+        PMIX_EQUAL == PMIx_Value_compare(existing->value, kval->value)) {
+        return PMIX_SUCCESS;
+    }
+    size_t needed = 0;
+    rc = pmix_gds_shmem_get_value_size(kval->value, &needed);
+    if (PMIX_SUCCESS != rc) {
+        return PMIX_ERR_NOT_AVAILABLE;
+    }
+    // Account for the kval, its key, and alignment padding.
+    needed += sizeof(pmix_kval_t) + sizeof(pmix_value_t);
+    needed += strlen(kval->key) + 1 + 4 * sizeof(uint64_t);
+    if (NULL == rlist) {
+        needed += sizeof(pmix_list_t) + sizeof(uint64_t);
+    }
+    // The kval, its key, its value, and the value's payload, plus the list.
+    if (!pmix_gds_shmem_arena_reserve(tma, needed, 5)) {
+        PMIX_GDS_SHMEM_VOUT(
+            "%s: modex segment for namespace=%s is full", __func__,
+            job->nspace_id
+        );
+        // Readers would keep finding the stale copy, so we
+        // cannot hand an update off to another module.
+        if (NULL != existing) {
+            rc = PMIX_ERR_OUT_OF_RESOURCE;
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        return PMIX_ERR_NOT_AVAILABLE;
+    }
+    // Copy the value first so that readers never see a partial entry.
+    pmix_value_t *value = NULL;
+    PMIX_GDS_SHMEM_VALUE_XFER(rc, value, kval->value, tma);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (NULL != existing) {
+        // The old copy stays in the arena: readers may still be using it.
+        pmix_atomic_wmb();
+        existing->value = value;
+        return PMIX_SUCCESS;
+    }
+    if (NULL == rlist) {
+        rlist = PMIX_NEW(pmix_list_t, tma);
+        if (NULL == rlist) {
+            return PMIX_ERR_NOMEM;
+        }
+        pmix_atomic_wmb();
+        mdata->ranks[rank] = rlist;
+    }
+    pmix_kval_t *kv = PMIX_NEW(pmix_kval_t, tma);
+    if (NULL == kv) {
+        return PMIX_ERR_NOMEM;
+    }
+    kv->key = pmix_tma_strdup(tma, kval->key);
+    kv->value = value;
+    publish_list_item(rlist, &kv->super);
+
+    PMIX_GDS_SHMEM_VOUT(
+        "%s:%s stored key=%s for rank=%u in modex segment",
+        __func__, PMIX_NAME_PRINT(&pmix_globals.myid), kval->key, rank
+    );
+    return rc;
+}
+
 /*
  * vim: ft=cpp ts=4 sts=4 sw=4 expandtab
  */
@@ -62,6 +62,18 @@ pmix_gds_shmem_store_job_array(
     char ***nodes
 );
 
+/**
+ * Stores a remote (modex) value for the given rank in the job's modex segment.
+ * Returns PMIX_ERR_NOT_AVAILABLE if the segment cannot hold the value, in
+ * which case the caller should hand it to the full-featured gds module.
+ */
+PMIX_EXPORT pmix_status_t
+pmix_gds_shmem_store_modex_kval(
+    pmix_gds_shmem_job_t *job,
+    pmix_rank_t rank,
+    pmix_kval_t *kval
+);
+
 END_C_DECLS
 
 #endif
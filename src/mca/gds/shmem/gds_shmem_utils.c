@@ -66,7 +66,7 @@ pmix_gds_shmem_get_job_tracker(
     }
     // Create one if not found and asked to create one.
     if (!target_tracker && create) {
-        pmix_namespace_t *ns = NULL, *inspace = NULL;
+        pmix_namespace_t *inspace = NULL;
         target_tracker = PMIX_NEW(pmix_gds_shmem_job_t);
         if (!target_tracker) {
             rc = PMIX_ERR_NOMEM;
@@ -78,12 +78,7 @@ pmix_gds_shmem_get_job_tracker(
             goto out;
         }
         // See if we already have this nspace in global namespaces.
-        PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-            if (0 == strcmp(ns->nspace, nspace)) {
-                inspace = ns;
-                break;
-            }
-        }
+        inspace = pmix_nspace_lookup(nspace);
         // If not, create one and update global namespace list.
         if (!inspace) {
             inspace = PMIX_NEW(pmix_namespace_t);
@@ -96,7 +91,7 @@ pmix_gds_shmem_get_job_tracker(
                 rc = PMIX_ERR_NOMEM;
                 goto out;
             }
-            pmix_list_append(&pmix_globals.nspaces, &inspace->super);
+            pmix_nspace_add(inspace);
         }
         PMIX_RETAIN(inspace);
         target_tracker->nspace = inspace;
@@ -273,6 +268,9 @@ pmix_gds_shmem_get_value_size(
         case PMIX_PROC_RANK:
             total += sizeof(pmix_rank_t);
             break;
+        case PMIX_BYTE_OBJECT:
+        case PMIX_COMPRESSED_BYTE_OBJECT:
+        case PMIX_COMPRESSED_STRING:
         case PMIX_REGEX:
             total += sizeof(pmix_byte_object_t);
             total += value->data.bo.size;
@@ -294,9 +292,7 @@ pmix_gds_shmem_get_value_size(
             break;
         case PMIX_APP:
         case PMIX_BUFFER:
-        case PMIX_BYTE_OBJECT:
         case PMIX_COMMAND:
-        case PMIX_COMPRESSED_STRING:
         case PMIX_COORD:
         case PMIX_DATA_BUFFER:
         case PMIX_DATA_TYPE:
@@ -400,12 +396,31 @@ get_shmem_backing_path(
  */
 pmix_status_t
 pmix_gds_shmem_segment_create_and_attach(
-    pmix_gds_shmem_job_t *job,
+    pmix_shmem_t *shmem,
     const char *segment_id,
     size_t segment_size
+) {
+    // Find a unique path for the shared-memory backing file.
+    const char *segment_path = get_shmem_backing_path(segment_id);
+    if (!segment_path) {
+        PMIX_ERROR_LOG(PMIX_ERROR);
+        return PMIX_ERROR;
+    }
+    return pmix_gds_shmem_segment_create_and_attach_path(
+        shmem, segment_path, segment_size
+    );
+}
+
+/**
+ * Create and attach to a shared-memory segment backed by the given path.
+ */
+pmix_status_t
+pmix_gds_shmem_segment_create_and_attach_path(
+    pmix_shmem_t *shmem,
+    const char *segment_path,
+    size_t segment_size
 ) {
     pmix_status_t rc = PMIX_SUCCESS;
-    const char *segment_path = NULL;
     uintptr_t mmap_addr = 0;
     // Find a hole in virtual memory that meets our size requirements.
     size_t base_addr = 0;
@@ -419,32 +434,26 @@ pmix_gds_shmem_segment_create_and_attach(
         "%s: found vmhole at address=0x%zx",
         __func__, base_addr
     );
-    // Find a unique path for the shared-memory backing file.
-    segment_path = get_shmem_backing_path(segment_id);
-    if (!segment_path) {
-        rc = PMIX_ERROR;
-        goto out;
-    }
     PMIX_GDS_SHMEM_VOUT(
         "%s: segment backing file path is %s (size=%zd B)",
         __func__, segment_path, segment_size
     );
     // Create a shared-memory segment backing store at the given path.
     rc = pmix_shmem_segment_create(
-        job->shmem, segment_size, segment_path
+        shmem, segment_size, segment_path
     );
     if (PMIX_SUCCESS != rc) {
         goto out;
     }
     // Attach to the shared-memory segment with the given address.
     rc = pmix_shmem_segment_attach(
-        job->shmem, (void *)base_addr, &mmap_addr
+        shmem, (void *)base_addr, &mmap_addr
     );
     if (PMIX_SUCCESS != rc) {
         goto out;
     }
     // Make sure that we mapped to the requested address.
-    if (mmap_addr != (uintptr_t)job->shmem->base_address) {
+    if (mmap_addr != (uintptr_t)shmem->base_address) {
         // TODO(skg) Add a nice error message.
         rc = PMIX_ERROR;
         goto out;
@@ -454,7 +463,7 @@ pmix_gds_shmem_segment_create_and_attach(
     );
 out:
     if (PMIX_SUCCESS != rc) {
-        (void)pmix_shmem_segment_detach(job->shmem);
+        (void)pmix_shmem_segment_detach(shmem);
         PMIX_ERROR_LOG(rc);
     }
     return rc;
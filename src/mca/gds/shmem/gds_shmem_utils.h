@@ -88,11 +88,18 @@ pmix_gds_shmem_pad_amount_to_page(
 
 PMIX_EXPORT pmix_status_t
 pmix_gds_shmem_segment_create_and_attach(
-    pmix_gds_shmem_job_t *job,
+    pmix_shmem_t *shmem,
     const char *segment_id,
     size_t segment_size
 );
 
+PMIX_EXPORT pmix_status_t
+pmix_gds_shmem_segment_create_and_attach_path(
+    pmix_shmem_t *shmem,
+    const char *segment_path,
+    size_t segment_size
+);
+
 PMIX_EXPORT pmix_status_t
 pmix_gds_shmem_value_xfer(
     pmix_value_t *p,
@@ -51,7 +51,7 @@ pmix_status_t pmix_pmdl_base_harvest_envars(char *nspace, const pmix_info_t info
 {
     pmix_pmdl_base_active_module_t *active;
     pmix_status_t rc;
-    pmix_namespace_t *nptr = NULL, *ns;
+    pmix_namespace_t *nptr = NULL;
     char *params[2] = {"PMIX_MCA_", NULL};
     char **priors = NULL;
 
@@ -67,15 +67,9 @@ pmix_status_t pmix_pmdl_base_harvest_envars(char *nspace, const pmix_info_t info
     }
 
     if (NULL != nspace) {
-        nptr = NULL;
         /* find this nspace - note that it may not have
          * been registered yet */
-        PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-            if (0 == strcmp(ns->nspace, nspace)) {
-                nptr = ns;
-                break;
-            }
-        }
+        nptr = pmix_nspace_lookup(nspace);
         if (NULL == nptr) {
             /* add it */
             nptr = PMIX_NEW(pmix_namespace_t);
@@ -83,7 +77,7 @@ pmix_status_t pmix_pmdl_base_harvest_envars(char *nspace, const pmix_info_t info
                 return PMIX_ERR_NOMEM;
             }
             nptr->nspace = strdup(nspace);
-            pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+            pmix_nspace_add(nptr);
         }
     }
 
@@ -235,20 +229,14 @@ pmix_status_t pmix_pmdl_base_setup_fork(const pmix_proc_t *proc, char ***env)
 void pmix_pmdl_base_deregister_nspace(const char *ns)
 {
     pmix_pmdl_base_active_module_t *active;
-    pmix_namespace_t *nptr, *n2;
+    pmix_namespace_t *nptr;
 
     if (!pmix_pmdl_globals.initialized) {
         return;
     }
 
     /* search for the namespace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (n2, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strncmp(ns, n2->nspace, PMIX_MAX_NSLEN)) {
-            nptr = n2;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(ns);
     if (NULL == nptr) {
         return;
     }
@@ -206,6 +206,117 @@
         }                                                    \
     } while (0)
 
+/**
+ * Packing conversion of a block of integer values to their flexible
+ * representation, with the type dispatch done once for the block.
+ *
+ * r - return status code
+ * t - type (pmix_data_type_t) of the integer values
+ * s - pointer (uint8_t *) to the first of n values of type (t)
+ * d - array of n flexible representation output values (uint64_t)
+ * n - number of values
+ */
+#define FLEX128_PACK_CONVERT_LOOP(conv, type, s, d, n)        \
+    do {                                                      \
+        size_t __i;                                           \
+        for (__i = 0; __i < (n); __i++) {                     \
+            conv(type, (s) + __i * sizeof(type), (d)[__i]);   \
+        }                                                     \
+    } while (0)
+
+#define FLEX128_PACK_CONVERT_BLOCK(r, t, s, d, n)                                     \
+    do {                                                                              \
+        (r) = PMIX_SUCCESS;                                                           \
+        switch (t) {                                                                  \
+        case PMIX_INT16:                                                              \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_SIGNED, int16_t, s, d, n);    \
+            break;                                                                    \
+        case PMIX_UINT16:                                                             \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_UNSIGNED, uint16_t, s, d, n); \
+            break;                                                                    \
+        case PMIX_INT:                                                                \
+        case PMIX_INT32:                                                              \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_SIGNED, int32_t, s, d, n);    \
+            break;                                                                    \
+        case PMIX_UINT:                                                               \
+        case PMIX_UINT32:                                                             \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_UNSIGNED, uint32_t, s, d, n); \
+            break;                                                                    \
+        case PMIX_INT64:                                                              \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_SIGNED, int64_t, s, d, n);    \
+            break;                                                                    \
+        case PMIX_SIZE:                                                               \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_UNSIGNED, size_t, s, d, n);   \
+            break;                                                                    \
+        case PMIX_UINT64:                                                             \
+            FLEX128_PACK_CONVERT_LOOP(FLEX128_PACK_CONVERT_UNSIGNED, uint64_t, s, d, n); \
+            break;                                                                    \
+        default:                                                                      \
+            (r) = PMIX_ERR_BAD_PARAM;                                                 \
+        }                                                                             \
+    } while (0)
+
+/**
+ * Unpacking conversion of a block of flexible representation values
+ * to integers, with the type dispatch done once for the block.
+ *
+ * r - return status code
+ * t - type (pmix_data_type_t) of the integer values
+ * s - array of n flex-representation values (uint64_t)
+ * d - pointer (uint8_t *) to the output buffer for n values of type (t)
+ * n - number of values
+ */
+#define FLEX128_UNPACK_CONVERT_LOOP(conv, type, s, d, n)      \
+    do {                                                      \
+        size_t __i;                                           \
+        for (__i = 0; __i < (n); __i++) {                     \
+            conv(type, (s)[__i], (d) + __i * sizeof(type));   \
+        }                                                     \
+    } while (0)
+
+#define FLEX128_UNPACK_CONVERT_BLOCK(r, t, s, d, n)                                       \
+    do {                                                                                  \
+        (r) = PMIX_SUCCESS;                                                               \
+        switch (t) {                                                                      \
+        case PMIX_INT16:                                                                  \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_SIGNED, int16_t, s, d, n);    \
+            break;                                                                        \
+        case PMIX_UINT16:                                                                 \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_UNSIGNED, uint16_t, s, d, n); \
+            break;                                                                        \
+        case PMIX_INT:                                                                    \
+        case PMIX_INT32:                                                                  \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_SIGNED, int32_t, s, d, n);    \
+            break;                                                                        \
+        case PMIX_UINT:                                                                   \
+        case PMIX_UINT32:                                                                 \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_UNSIGNED, uint32_t, s, d, n); \
+            break;                                                                        \
+        case PMIX_INT64:                                                                  \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_SIGNED, int64_t, s, d, n);    \
+            break;                                                                        \
+        case PMIX_SIZE:                                                                   \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_UNSIGNED, size_t, s, d, n);   \
+            break;                                                                        \
+        case PMIX_UINT64:                                                                 \
+            FLEX128_UNPACK_CONVERT_LOOP(FLEX128_UNPACK_CONVERT_UNSIGNED, uint64_t, s, d, n); \
+            break;                                                                        \
+        default:                                                                          \
+            (r) = PMIX_ERR_BAD_PARAM;                                                     \
+        }                                                                                 \
+    } while (0)
+
+/* number of values the batch functions convert at a time on the stack */
+#define FLEX128_BLOCK 256
+
+/* the batch decoder can pick a whole value out of a single 64-bit
+ * load when the representation is the 64-bit one and the load puts
+ * the first byte in the low bits */
+#if SIZEOF_SIZE_T == 8 && !defined(WORDS_BIGENDIAN) && defined(__GNUC__)
+#    define FLEX128_WORD_DECODE 1
+#    define FLEX128_CONT_FLAGS  0x8080808080808080ULL
+#endif
+
 static pmix_status_t flex128_init(void);
 
 static void flex128_finalize(void);
@@ -222,13 +333,21 @@ static size_t flex_pack_integer(size_t val, uint8_t out_buf[FLEX_BASE7_MAX_BUF_S
 static size_t flex_unpack_integer(const uint8_t in_buf[], size_t buf_size, size_t *out_val,
                                   size_t *out_val_size);
 
+static pmix_status_t flex128_encode_ints(pmix_data_type_t type, const void *src, size_t num_vals,
+                                         void *dst, size_t *size);
+
+static pmix_status_t flex128_decode_ints(pmix_data_type_t type, const void *src, size_t src_len,
+                                         void *dest, size_t num_vals, size_t *src_used);
+
 pmix_psquash_base_module_t pmix_flex128_module = {.name = "flex128",
                                                   .int_type_is_encoded = true,
                                                   .init = flex128_init,
                                                   .finalize = flex128_finalize,
                                                   .get_max_size = flex128_get_max_size,
                                                   .encode_int = flex128_encode_int,
-                                                  .decode_int = flex128_decode_int};
+                                                  .decode_int = flex128_decode_int,
+                                                  .encode_ints = flex128_encode_ints,
+                                                  .decode_ints = flex128_decode_ints};
 
 static pmix_status_t flex128_init(void)
 {
@@ -296,6 +415,170 @@ static pmix_status_t flex128_decode_int(pmix_data_type_t type, void *src, size_t
     return rc;
 }
 
+static pmix_status_t flex128_encode_ints(pmix_data_type_t type, const void *src, size_t num_vals,
+                                         void *dst, size_t *size)
+{
+    pmix_status_t rc;
+    uint64_t vals[FLEX128_BLOCK];
+    const uint8_t *in = (const uint8_t *) src;
+    uint8_t *out = (uint8_t *) dst;
+    size_t val_size, done, n, i;
+
+    PMIX_SQUASH_TYPE_SIZEOF(rc, type, val_size);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+
+    for (done = 0; done < num_vals; done += n) {
+        n = num_vals - done;
+        if (FLEX128_BLOCK < n) {
+            n = FLEX128_BLOCK;
+        }
+        FLEX128_PACK_CONVERT_BLOCK(rc, type, in + done * val_size, vals, n);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+        for (i = 0; i < n; i++) {
+            if (PMIX_LIKELY(vals[i] < FLEX_BASE7_CONT_FLAG)) {
+                *out++ = (uint8_t) vals[i];
+            } else {
+                out += flex_pack_integer(vals[i], out);
+            }
+        }
+    }
+    *size = out - (uint8_t *) dst;
+
+    return PMIX_SUCCESS;
+}
+
+#ifdef FLEX128_WORD_DECODE
+/*
+ * Decode the value starting at in[0] from a single 64-bit load. The
+ * first byte without the continuation flag ends the value, so the
+ * length comes from the lowest clear flag bit, and the 7-bit groups
+ * are then squeezed together pairwise in three steps. A value with
+ * all eight flags set carries a ninth, raw byte. Returns the number
+ * of bytes consumed, or zero if that ninth byte is not available.
+ */
+static inline size_t flex_decode_word(const uint8_t *in, size_t avail, uint64_t *out_val)
+{
+    uint64_t word, stop, x;
+    size_t len;
+
+    memcpy(&word, in, sizeof(word));
+    stop = ~word & FLEX128_CONT_FLAGS;
+    if (PMIX_LIKELY(0 != stop)) {
+        len = (__builtin_ctzll(stop) >> 3) + 1;
+        x = word & (stop ^ (stop - 1)) & ~FLEX128_CONT_FLAGS;
+    } else {
+        if (avail < FLEX_BASE7_MAX_BUF_SIZE) {
+            return 0;
+        }
+        len = FLEX_BASE7_MAX_BUF_SIZE;
+        x = word & ~FLEX128_CONT_FLAGS;
+    }
+    x = ((x & 0x7f007f007f007f00ULL) >> 1) | (x & 0x007f007f007f007fULL);
+    x = ((x & 0x3fff00003fff0000ULL) >> 2) | (x & 0x00003fff00003fffULL);
+    x = ((x & 0x0fffffff00000000ULL) >> 4) | (x & 0x000000000fffffffULL);
+    if (PMIX_UNLIKELY(FLEX_BASE7_MAX_BUF_SIZE == len)) {
+        x |= (uint64_t) in[SIZEOF_SIZE_T] << (SIZEOF_SIZE_T * FLEX_BASE7_SHIFT);
+    }
+    *out_val = x;
+    return len;
+}
+#endif
+
+/*
+ * Decode n values into their flexible representation, returning the
+ * number of bytes consumed or zero if the input runs out first.
+ */
+static size_t flex_decode_block(const uint8_t *in, size_t avail, uint64_t *out, size_t n)
+{
+    size_t pos = 0, i = 0, len, tmp, val_size;
+#ifdef FLEX128_WORD_DECODE
+    uint64_t word;
+    size_t k;
+
+    while (i < n && sizeof(word) <= avail - pos) {
+        memcpy(&word, in + pos, sizeof(word));
+        if (0 == (word & FLEX128_CONT_FLAGS) && sizeof(word) <= n - i) {
+            /* eight single-byte values in a row */
+            for (k = 0; k < sizeof(word); k++) {
+                out[i + k] = in[pos + k];
+            }
+            i += sizeof(word);
+            pos += sizeof(word);
+            continue;
+        }
+        len = flex_decode_word(in + pos, avail - pos, &out[i]);
+        if (0 == len) {
+            break;
+        }
+        pos += len;
+        ++i;
+    }
+#endif
+    /* whatever is too close to the end for a full load */
+    for (; i < n; i++) {
+        if (pos >= avail) {
+            return 0;
+        }
+        pos += flex_unpack_integer(in + pos, avail - pos, &tmp, &val_size);
+        out[i] = tmp;
+    }
+    return pos;
+}
+
+static pmix_status_t flex128_decode_ints(pmix_data_type_t type, const void *src, size_t src_len,
+                                         void *dest, size_t num_vals, size_t *src_used)
+{
+    pmix_status_t rc;
+    uint64_t vals[FLEX128_BLOCK], over;
+    const uint8_t *in = (const uint8_t *) src;
+    uint8_t *out = (uint8_t *) dest;
+    size_t val_size, done, n, i, len, used = 0;
+
+    PMIX_SQUASH_TYPE_SIZEOF(rc, type, val_size);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+
+    for (done = 0; done < num_vals; done += n) {
+        n = num_vals - done;
+        if (FLEX128_BLOCK < n) {
+            n = FLEX128_BLOCK;
+        }
+        len = flex_decode_block(in + used, src_len - used, vals, n);
+        if (0 == len) {
+            return PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER;
+        }
+        used += len;
+        /* sanity check - every value must fit the type */
+        if (val_size < sizeof(uint64_t)) {
+            over = 0;
+            for (i = 0; i < n; i++) {
+                over |= vals[i] >> (val_size * CHAR_BIT);
+            }
+            if (0 != over) {
+                rc = PMIX_ERR_UNPACK_FAILURE;
+                PMIX_ERROR_LOG(rc);
+                return rc;
+            }
+        }
+        FLEX128_UNPACK_CONVERT_BLOCK(rc, type, vals, out + done * val_size, n);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            return rc;
+        }
+    }
+    *src_used = used;
+
+    return PMIX_SUCCESS;
+}
+
 /*
  * Typical representation of a number in computer systems is:
  * A[0]*B^0 + A[1]*B^1 + A[2]*B^2 + ... + A[n]*B^n
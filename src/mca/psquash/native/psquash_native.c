@@ -41,13 +41,21 @@ static pmix_status_t native_encode_int(pmix_data_type_t type, void *src, void *d
 static pmix_status_t native_decode_int(pmix_data_type_t type, void *src, size_t src_len, void *dest,
                                        size_t *dst_size);
 
+static pmix_status_t native_encode_ints(pmix_data_type_t type, const void *src, size_t num_vals,
+                                        void *dst, size_t *size);
+
+static pmix_status_t native_decode_ints(pmix_data_type_t type, const void *src, size_t src_len,
+                                        void *dest, size_t num_vals, size_t *src_used);
+
 pmix_psquash_base_module_t pmix_psquash_native_module = {.name = "native",
                                                          .int_type_is_encoded = false,
                                                          .init = native_init,
                                                          .finalize = native_finalize,
                                                          .get_max_size = native_get_max_size,
                                                          .encode_int = native_encode_int,
-                                                         .decode_int = native_decode_int};
+                                                         .decode_int = native_decode_int,
+                                                         .encode_ints = native_encode_ints,
+                                                         .decode_ints = native_decode_ints};
 
 #define NATIVE_PACK_CONVERT(ret, type, val)  \
     do {                                     \
@@ -179,3 +187,75 @@ static pmix_status_t native_decode_int(pmix_data_type_t type, void *src, size_t
 
     return PMIX_SUCCESS;
 }
+
+/* convert num_vals values of the given size between host and network
+ * byte order - the conversion is its own inverse */
+static void native_swap_ints(size_t val_size, const uint8_t *in, uint8_t *out, size_t num_vals)
+{
+    size_t i;
+
+    switch (val_size) {
+    case 2:
+        for (i = 0; i < num_vals; i++) {
+            uint16_t v;
+            memcpy(&v, in + 2 * i, 2);
+            v = pmix_htons(v);
+            memcpy(out + 2 * i, &v, 2);
+        }
+        break;
+    case 4:
+        for (i = 0; i < num_vals; i++) {
+            uint32_t v;
+            memcpy(&v, in + 4 * i, 4);
+            v = htonl(v);
+            memcpy(out + 4 * i, &v, 4);
+        }
+        break;
+    default:
+        for (i = 0; i < num_vals; i++) {
+            uint64_t v;
+            memcpy(&v, in + 8 * i, 8);
+            v = pmix_hton64(v);
+            memcpy(out + 8 * i, &v, 8);
+        }
+        break;
+    }
+}
+
+static pmix_status_t native_encode_ints(pmix_data_type_t type, const void *src, size_t num_vals,
+                                        void *dst, size_t *size)
+{
+    pmix_status_t rc;
+    size_t val_size;
+
+    PMIX_SQUASH_TYPE_SIZEOF(rc, type, val_size);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    native_swap_ints(val_size, (const uint8_t *) src, (uint8_t *) dst, num_vals);
+    *size = num_vals * val_size;
+
+    return PMIX_SUCCESS;
+}
+
+static pmix_status_t native_decode_ints(pmix_data_type_t type, const void *src, size_t src_len,
+                                        void *dst, size_t num_vals, size_t *src_used)
+{
+    pmix_status_t rc;
+    size_t val_size;
+
+    PMIX_SQUASH_TYPE_SIZEOF(rc, type, val_size);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    /* sanity check */
+    if (src_len < num_vals * val_size) {
+        return PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER;
+    }
+    native_swap_ints(val_size, (const uint8_t *) src, (uint8_t *) dst, num_vals);
+    *src_used = num_vals * val_size;
+
+    return PMIX_SUCCESS;
+}
@@ -77,6 +77,36 @@ typedef pmix_status_t (*pmix_psquash_encode_int_fn_t)(pmix_data_type_t type, voi
 typedef pmix_status_t (*pmix_psquash_decode_int_fn_t)(pmix_data_type_t type, void *src,
                                                       size_t src_len, void *dest, size_t *dst_len);
 
+/**
+ * Encode an array of basic integers into a contiguous destination buffer.
+ * The output is the same as calling encode_int on each value in turn.
+ *
+ * type     - Type of the values in 'src' (PMIX_SIZE, PMIX_INT to PMIX_UINT64)
+ * src      - pointer to an array of num_vals basic integers
+ * num_vals - number of values to encode
+ * dest     - pointer to buffer to store data - it must have room for
+ *            num_vals values of the size returned by get_max_size
+ * dst_len  - pointer to the total packed size of dest, in bytes
+ */
+typedef pmix_status_t (*pmix_psquash_encode_ints_fn_t)(pmix_data_type_t type, const void *src,
+                                                       size_t num_vals, void *dest,
+                                                       size_t *dst_len);
+
+/**
+ * Decode an array of basic integers from a contiguous buffer. The
+ * result is the same as calling decode_int for each value in turn.
+ *
+ * type     - Type of the values in 'dest' (PMIX_SIZE, PMIX_INT to PMIX_UINT64)
+ * src      - pointer to buffer where data was stored
+ * src_len  - length, in bytes, of the src buffer
+ * dest     - pointer to an array of num_vals basic integers
+ * num_vals - number of values to decode
+ * src_used - pointer to the number of bytes of src that were consumed
+ */
+typedef pmix_status_t (*pmix_psquash_decode_ints_fn_t)(pmix_data_type_t type, const void *src,
+                                                       size_t src_len, void *dest,
+                                                       size_t num_vals, size_t *src_used);
+
 /**
  * Base structure for a PSQUASH module
  */
@@ -95,6 +125,10 @@ typedef struct {
     /** Integer compression */
     pmix_psquash_encode_int_fn_t encode_int;
     pmix_psquash_decode_int_fn_t decode_int;
+
+    /** Batch integer compression */
+    pmix_psquash_encode_ints_fn_t encode_ints;
+    pmix_psquash_decode_ints_fn_t decode_ints;
 } pmix_psquash_base_module_t;
 
 /**
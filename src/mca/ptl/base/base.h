@@ -100,6 +100,12 @@ struct pmix_ptl_base_t {
     int wait_to_connect;
     int handshake_wait_time;
     int handshake_max_retries;
+    int handshake_threads;
+    size_t recv_buffer_size;
+    int send_coalesce_max;
+    size_t send_coalesce_bytes;
+    uint64_t send_msgs;     // messages completely sent
+    uint64_t send_syscalls; // writev calls that sent data
 };
 typedef struct pmix_ptl_base_t pmix_ptl_base_t;
 
@@ -137,6 +143,7 @@ PMIX_EXPORT pmix_status_t pmix_ptl_base_check_server_uris(pmix_peer_t *peer, cha
 PMIX_EXPORT pmix_status_t pmix_ptl_base_check_directives(pmix_info_t *info, size_t ninfo);
 PMIX_EXPORT pmix_status_t pmix_ptl_base_setup_fork(const pmix_proc_t *proc, char ***env);
 PMIX_EXPORT void pmix_ptl_base_send_handler(int sd, short flags, void *cbdata);
+PMIX_EXPORT void pmix_ptl_base_get_send_stats(uint64_t *nmsgs, uint64_t *nsyscalls);
 PMIX_EXPORT void pmix_ptl_base_recv_handler(int sd, short flags, void *cbdata);
 PMIX_EXPORT void pmix_ptl_base_process_msg(int fd, short flags, void *cbdata);
 PMIX_EXPORT pmix_status_t pmix_ptl_base_set_nonblocking(int sd);
@@ -146,6 +153,7 @@ PMIX_EXPORT pmix_status_t pmix_ptl_base_recv_blocking(int sd, char *data, size_t
 PMIX_EXPORT pmix_status_t pmix_ptl_base_connect(struct sockaddr_storage *addr, pmix_socklen_t len,
                                                 int *fd);
 PMIX_EXPORT void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata);
+PMIX_EXPORT pmix_status_t pmix_ptl_base_recv_connect_msg(pmix_pending_connection_t *pnd);
 PMIX_EXPORT pmix_status_t pmix_ptl_base_setup_listener(pmix_info_t info[], size_t ninfo);
 PMIX_EXPORT pmix_status_t pmix_ptl_base_send_connect_ack(int sd);
 PMIX_EXPORT pmix_status_t pmix_ptl_base_recv_connect_ack(int sd);
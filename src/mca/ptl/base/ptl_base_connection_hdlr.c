@@ -51,31 +51,17 @@ static void cnct_cbfunc(pmix_status_t status, pmix_proc_t *proc, void *cbdata);
 static void _check_cached_events(pmix_peer_t *peer);
 static pmix_status_t process_tool_request(pmix_pending_connection_t *pnd, char *mg, size_t cnt);
 
-void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata)
+/* Read the connection request from a newly accepted socket and
+ * unpack it into the pending connection object. This touches
+ * nothing but the object itself, and so it is safe to call
+ * from a handshake thread */
+pmix_status_t pmix_ptl_base_recv_connect_msg(pmix_pending_connection_t *pnd)
 {
-    pmix_pending_connection_t *pnd = (pmix_pending_connection_t *) cbdata;
     pmix_ptl_hdr_t hdr;
-    pmix_peer_t *peer = NULL;
-    pmix_status_t rc, reply;
-    char *msg = NULL, *mg, *p, *blob = NULL;
-    uint32_t u32;
+    char *msg = NULL, *mg, *p;
     size_t cnt;
-    pmix_namespace_t *nptr, *tmp;
-    pmix_rank_info_t *info = NULL, *iptr;
-    pmix_proc_t proc;
-    pmix_info_t ginfo;
-    pmix_byte_object_t cred;
     uint8_t major, minor, release;
 
-    /* acquire the object */
-    PMIX_ACQUIRE_OBJECT(pnd);
-
-    // must use sd, args to avoid -Werror
-    PMIX_HIDE_UNUSED_PARAMS(sd, args);
-
-    pmix_output_verbose(8, pmix_ptl_base_framework.framework_output,
-                        "ptl:base:connection_handler: new connection: %d", pnd->sd);
-
     /* ensure the socket is in blocking mode */
     pmix_ptl_base_set_blocking(pnd->sd);
 
@@ -228,10 +214,56 @@ void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata)
 
         /* extract the blob */
         if (0 < cnt) {
-            PMIX_PTL_GET_BLOB(blob, cnt);
+            PMIX_PTL_GET_BLOB(pnd->blob, cnt);
+            pnd->bloblen = cnt;
         }
     }
 
+    free(msg);
+    pnd->preread = true;
+    return PMIX_SUCCESS;
+
+error:
+    if (NULL != msg) {
+        free(msg);
+    }
+    return PMIX_ERR_UNREACH;
+}
+
+void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata)
+{
+    pmix_pending_connection_t *pnd = (pmix_pending_connection_t *) cbdata;
+    pmix_peer_t *peer = NULL;
+    pmix_status_t rc, reply;
+    char *blob = NULL;
+    uint32_t u32;
+    size_t cnt;
+    pmix_namespace_t *nptr;
+    pmix_rank_info_t *info = NULL, *iptr;
+    pmix_proc_t proc;
+    pmix_info_t ginfo;
+    pmix_byte_object_t cred;
+
+    /* acquire the object */
+    PMIX_ACQUIRE_OBJECT(pnd);
+
+    // must use sd, args to avoid -Werror
+    PMIX_HIDE_UNUSED_PARAMS(sd, args);
+
+    pmix_output_verbose(8, pmix_ptl_base_framework.framework_output,
+                        "ptl:base:connection_handler: new connection: %d", pnd->sd);
+
+    /* read and parse the connection request unless a
+     * handshake thread already did it for us */
+    if (!pnd->preread) {
+        if (PMIX_SUCCESS != pmix_ptl_base_recv_connect_msg(pnd)) {
+            goto error;
+        }
+    }
+    blob = pnd->blob;
+    pnd->blob = NULL;
+    cnt = pnd->bloblen;
+
     /* see if this is a tool connection request */
     if (PMIX_SIMPLE_CLIENT != pnd->flag) {
         /* nope, it's for a tool, so process it
@@ -244,20 +276,13 @@ void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata)
         if (NULL != blob) {
             free(blob);
         }
-        free(msg);
         return;
     }
 
     /* it is a client that is connecting, so it should have
      * been registered with us prior to being started.
      * See if we know this nspace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(tmp->nspace, pnd->proc.nspace)) {
-            nptr = tmp;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(pnd->proc.nspace);
     if (NULL == nptr) {
         /* we don't know this namespace, reject it */
         rc = PMIX_ERR_NOT_FOUND;
@@ -349,10 +374,9 @@ void pmix_ptl_base_connection_handler(int sd, short args, void *cbdata)
         nptr->version_stored = true;
     }
 
-    free(msg); // can now release the data buffer
-    msg = NULL;
-
-    /* validate the connection */
+    /* validate the connection - this is done here on the progress
+     * thread even when handshake threads read the request, as the
+     * psec modules work on the peer and our nspace tables */
     cred.bytes = pnd->cred;
     cred.size = pnd->len;
     PMIX_PSEC_VALIDATE_CONNECTION(reply, peer, NULL, 0, NULL, NULL, &cred);
@@ -436,9 +460,6 @@ error:
         info->proc_cnt--;
         PMIX_RELEASE(info);
     }
-    if (NULL != msg) {
-        free(msg);
-    }
     if (NULL != blob) {
         free(blob);
     }
@@ -526,7 +547,7 @@ static void process_cbfunc(int sd, short args, void *cbdata)
     if (PMIX_TOOL_CLIENT != pnd->flag && PMIX_LAUNCHER_CLIENT != pnd->flag) {
         PMIX_RETAIN(nptr);
         nptr->nspace = strdup(cd->proc.nspace);
-        pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+        pmix_nspace_add(nptr);
         info = PMIX_NEW(pmix_rank_info_t);
         info->pname.nspace = strdup(nptr->nspace);
         info->pname.rank = cd->proc.rank;
@@ -637,7 +658,7 @@ error:
     CLOSE_THE_SOCKET(pnd->sd);
     PMIX_RELEASE(pnd);
     PMIX_RELEASE(peer);
-    pmix_list_remove_item(&pmix_globals.nspaces, &nptr->super);
+    pmix_nspace_remove(nptr);
     PMIX_RELEASE(nptr); // will release the info object
     PMIX_RELEASE(cd);
     if (NULL != req) {
@@ -671,7 +692,7 @@ static void cnct_cbfunc(pmix_status_t status, pmix_proc_t *proc, void *cbdata)
 static pmix_status_t process_tool_request(pmix_pending_connection_t *pnd, char *mg, size_t cnt)
 {
     pmix_peer_t *peer;
-    pmix_namespace_t *nptr, *tmp;
+    pmix_namespace_t *nptr;
     pmix_rank_info_t *info;
     bool found;
     size_t n;
@@ -692,13 +713,7 @@ static pmix_status_t process_tool_request(pmix_pending_connection_t *pnd, char *
          * nspace - it doesn't add the peer object to our array
          * of local clients. So let's start by searching for
          * the nspace object */
-        nptr = NULL;
-        PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-            if (0 == strcmp(tmp->nspace, pnd->proc.nspace)) {
-                nptr = tmp;
-                break;
-            }
-        }
+        nptr = pmix_nspace_lookup(pnd->proc.nspace);
         if (NULL == nptr) {
             /* it is possible that this is a tool inside of
              * a job-script as part of a multi-spawn operation.
@@ -842,8 +857,7 @@ static pmix_status_t process_tool_request(pmix_pending_connection_t *pnd, char *
 
 static void _check_cached_events(pmix_peer_t *peer)
 {
-    pmix_notify_caddy_t *cd;
-    int i;
+    pmix_notify_caddy_t *cd, *next;
     size_t n;
     pmix_range_trkr_t rngtrk;
     pmix_buffer_t *relay;
@@ -854,11 +868,8 @@ static void _check_cached_events(pmix_peer_t *peer)
 
     PMIX_LOAD_PROCID(&proc, peer->info->pname.nspace, peer->info->pname.rank);
 
-    for (i = 0; i < pmix_globals.max_events; i++) {
-        pmix_hotel_knock(&pmix_globals.notifications, i, (void **) &cd);
-        if (NULL == cd) {
-            continue;
-        }
+    for (cd = pmix_globals.oldest_notification; NULL != cd; cd = next) {
+        next = cd->newer;
         /* check the range */
         if (NULL == cd->targets) {
             rngtrk.procs = &cd->source;
@@ -883,7 +894,7 @@ static void _check_cached_events(pmix_peer_t *peer)
                     /* if this is the last one, then evict this event
                      * from the cache */
                     if (0 == cd->nleft) {
-                        pmix_hotel_checkout(&pmix_globals.notifications, cd->room);
+                        pmix_notify_event_uncache(cd);
                         found = true; // mark that we should release cd
                     }
                     break;
@@ -56,7 +56,8 @@ static char *pmix_getline(FILE *fp);
 pmix_status_t pmix_ptl_base_set_peer(pmix_peer_t *peer, char *evar)
 {
     pmix_status_t rc;
-    char *vrs;
+    char *vrs, *bfrops, **mods;
+    int n;
 
     vrs = getenv("PMIX_VERSION");
 
@@ -67,8 +68,29 @@ pmix_status_t pmix_ptl_base_set_peer(pmix_peer_t *peer, char *evar)
 
         pmix_output_verbose(2, pmix_ptl_base_framework.framework_output, "V41 SERVER DETECTED");
 
-        /* must use the latest bfrops module */
-        PMIX_BFROPS_SET_MODULE(rc, pmix_globals.mypeer, peer, NULL);
+        /* use the best bfrops module we share with the server - if
+         * it didn't tell us what it supports, then it predates any
+         * module beyond v41. The v5compact module ranks below v41 so
+         * it is never our default, so ask for it by name when the
+         * server offers it */
+        bfrops = getenv("PMIX_BFROPS_MODE");
+        if (NULL == bfrops) {
+            bfrops = "v41";
+        } else {
+            mods = pmix_argv_split(bfrops, ',');
+            for (n = 0; NULL != mods && NULL != mods[n]; n++) {
+                if (0 == strcmp(mods[n], "v5compact")) {
+                    PMIX_BFROPS_SET_MODULE(rc, pmix_globals.mypeer, peer, "v5compact");
+                    if (PMIX_SUCCESS == rc) {
+                        pmix_argv_free(mods);
+                        return rc;
+                    }
+                    break;
+                }
+            }
+            pmix_argv_free(mods);
+        }
+        PMIX_BFROPS_SET_MODULE(rc, pmix_globals.mypeer, peer, bfrops);
         return rc;
     }
 
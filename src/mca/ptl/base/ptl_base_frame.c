@@ -27,6 +27,7 @@
 #include "src/include/pmix_config.h"
 
 #include "pmix_common.h"
+#include "src/include/pmix_stdint.h"
 
 #ifdef HAVE_STRING_H
 #    include <string.h>
@@ -104,7 +105,13 @@ pmix_ptl_base_t pmix_ptl_base = {
     .max_retries = 0,
     .wait_to_connect = 0,
     .handshake_wait_time = 0,
-    .handshake_max_retries = 0
+    .handshake_max_retries = 0,
+    .handshake_threads = 0,
+    .recv_buffer_size = 64 * 1024,
+    .send_coalesce_max = 16,
+    .send_coalesce_bytes = 256 * 1024,
+    .send_msgs = 0,
+    .send_syscalls = 0
 };
 int pmix_ptl_base_output = -1;
 pmix_ptl_module_t pmix_ptl = {
@@ -224,6 +231,38 @@ static int pmix_ptl_register(pmix_mca_base_register_flag_t flags)
     (void) pmix_mca_base_var_register_synonym(idx, "pmix", "ptl", "tcp", "report_uri",
                                               PMIX_MCA_BASE_VAR_SYN_FLAG_DEPRECATED);
 
+    pmix_mca_base_var_register("pmix", "ptl", "base", "handshake_threads",
+                               "Number of threads used to read and parse incoming "
+                               "connection requests before handing them to the progress "
+                               "thread (0 = handle them entirely on the progress thread). "
+                               "Credentials are always validated on the progress thread",
+                               PMIX_MCA_BASE_VAR_TYPE_INT,
+                               &pmix_ptl_base.handshake_threads);
+
+    pmix_mca_base_var_register("pmix", "ptl", "base", "recv_buffer_size",
+                               "Size (in bytes) of the buffer each connection keeps to "
+                               "read ahead so several messages can be received with a "
+                               "single read (0 = read each message separately)",
+                               PMIX_MCA_BASE_VAR_TYPE_SIZE_T,
+                               &pmix_ptl_base.recv_buffer_size);
+    /* we must at least be able to hold a header */
+    if (0 < pmix_ptl_base.recv_buffer_size
+        && pmix_ptl_base.recv_buffer_size < 2 * sizeof(pmix_ptl_hdr_t)) {
+        pmix_ptl_base.recv_buffer_size = 2 * sizeof(pmix_ptl_hdr_t);
+    }
+
+    pmix_mca_base_var_register("pmix", "ptl", "base", "send_coalesce_max",
+                               "Max number of queued messages to a peer to send with a "
+                               "single writev (1 = no coalescing)",
+                               PMIX_MCA_BASE_VAR_TYPE_INT,
+                               &pmix_ptl_base.send_coalesce_max);
+
+    pmix_mca_base_var_register("pmix", "ptl", "base", "send_coalesce_bytes",
+                               "Stop adding queued messages to a coalesced send once it "
+                               "holds this many bytes",
+                               PMIX_MCA_BASE_VAR_TYPE_SIZE_T,
+                               &pmix_ptl_base.send_coalesce_bytes);
+
     return PMIX_SUCCESS;
 }
 
@@ -237,6 +276,10 @@ static pmix_status_t pmix_ptl_close(void)
     pmix_ptl_base.initialized = false;
     pmix_ptl_base.selected = false;
 
+    pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                        "ptl:base sent %" PRIu64 " msgs in %" PRIu64 " writev calls",
+                        pmix_ptl_base.send_msgs, pmix_ptl_base.send_syscalls);
+
     /* ensure the listen thread has been shut down */
     pmix_ptl_base_stop_listening();
 
@@ -481,6 +524,9 @@ static void pccon(pmix_pending_connection_t *p)
     p->proc_type.minor = PMIX_MINOR_WILDCARD;
     p->proc_type.release = PMIX_RELEASE_WILDCARD;
     p->proc_type.flag = 0;
+    p->preread = false;
+    p->blob = NULL;
+    p->bloblen = 0;
 }
 static void pcdes(pmix_pending_connection_t *p)
 {
@@ -502,8 +548,11 @@ static void pcdes(pmix_pending_connection_t *p)
     if (NULL != p->cred) {
         free(p->cred);
     }
+    if (NULL != p->blob) {
+        free(p->blob);
+    }
 }
-PMIX_EXPORT PMIX_CLASS_INSTANCE(pmix_pending_connection_t, pmix_object_t, pccon, pcdes);
+PMIX_EXPORT PMIX_CLASS_INSTANCE(pmix_pending_connection_t, pmix_list_item_t, pccon, pcdes);
 
 static void lcon(pmix_listener_t *p)
 {
@@ -68,6 +68,113 @@ static void *listen_thread(void *obj);
 static pthread_t engine;
 static bool setup_complete = false;
 
+/* optional pool of threads that read and parse connection
+ * requests so that a storm of clients connecting at once
+ * doesn't serialize behind the progress thread on those reads.
+ * The credentials are not validated here - that still runs
+ * one request at a time on the progress thread */
+static void *handshake_thread(void *obj);
+static pthread_t *hs_threads = NULL;
+static int hs_nthreads = 0;
+static bool hs_active = false;
+static pthread_mutex_t hs_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t hs_cond = PTHREAD_COND_INITIALIZER;
+static pmix_list_t hs_queue;
+
+static void start_handshake_threads(void)
+{
+    int n;
+
+    if (0 >= pmix_ptl_base.handshake_threads
+        || pmix_ptl_base_connection_handler != pmix_ptl_base.listener.cbfunc) {
+        return;
+    }
+    PMIX_CONSTRUCT(&hs_queue, pmix_list_t);
+    hs_threads = (pthread_t *) calloc(pmix_ptl_base.handshake_threads, sizeof(pthread_t));
+    if (NULL == hs_threads) {
+        PMIX_DESTRUCT(&hs_queue);
+        return;
+    }
+    hs_active = true;
+    for (n = 0; n < pmix_ptl_base.handshake_threads; n++) {
+        if (0 != pthread_create(&hs_threads[n], NULL, handshake_thread, NULL)) {
+            break;
+        }
+    }
+    hs_nthreads = n;
+    pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                        "listen_thread: started %d handshake threads", hs_nthreads);
+    if (0 == hs_nthreads) {
+        /* fall back to handling them on the progress thread */
+        hs_active = false;
+        free(hs_threads);
+        hs_threads = NULL;
+        PMIX_DESTRUCT(&hs_queue);
+    }
+}
+
+static void stop_handshake_threads(void)
+{
+    pmix_pending_connection_t *pnd;
+    int n;
+
+    if (0 == hs_nthreads) {
+        return;
+    }
+    pthread_mutex_lock(&hs_lock);
+    hs_active = false;
+    pthread_cond_broadcast(&hs_cond);
+    pthread_mutex_unlock(&hs_lock);
+    for (n = 0; n < hs_nthreads; n++) {
+        pthread_join(hs_threads[n], NULL);
+    }
+    free(hs_threads);
+    hs_threads = NULL;
+    hs_nthreads = 0;
+    /* drop anything that never got processed */
+    while (NULL != (pnd = (pmix_pending_connection_t *) pmix_list_remove_first(&hs_queue))) {
+        CLOSE_THE_SOCKET(pnd->sd);
+        PMIX_RELEASE(pnd);
+    }
+    PMIX_DESTRUCT(&hs_queue);
+}
+
+static void *handshake_thread(void *obj)
+{
+    (void) obj;
+    pmix_pending_connection_t *pnd;
+
+    while (1) {
+        pthread_mutex_lock(&hs_lock);
+        while (hs_active && pmix_list_is_empty(&hs_queue)) {
+            pthread_cond_wait(&hs_cond, &hs_lock);
+        }
+        if (!hs_active) {
+            pthread_mutex_unlock(&hs_lock);
+            return NULL;
+        }
+        pnd = (pmix_pending_connection_t *) pmix_list_remove_first(&hs_queue);
+        pthread_mutex_unlock(&hs_lock);
+
+        /* do the blocking reads and unpacking here - only the
+         * validation and peer setup, which touch the server's
+         * global state, are left for the progress thread */
+        if (PMIX_SUCCESS != pmix_ptl_base_recv_connect_msg(pnd)) {
+            pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                                "handshake_thread: unable to read connection request on "
+                                "socket %d", pnd->sd);
+            CLOSE_THE_SOCKET(pnd->sd);
+            PMIX_RELEASE(pnd);
+            continue;
+        }
+        /* post the object */
+        PMIX_POST_OBJECT(pnd);
+        /* activate the event */
+        pmix_event_active(&pnd->ev, EV_WRITE, 1);
+    }
+    return NULL;
+}
+
 /*
  * start listening thread
  */
@@ -98,10 +205,15 @@ pmix_status_t pmix_ptl_base_start_listening(pmix_info_t info[], size_t ninfo)
         close(pmix_ptl_base.stop_thread[1]);
         return PMIX_ERR_OUT_OF_RESOURCE;
     }
+    /* start any handshake threads before the listener
+     * so they are ready for its first connection */
+    start_handshake_threads();
+
     /* fork off the listener thread */
     pmix_ptl_base.listen_thread_active = true;
     if (0 > pthread_create(&engine, NULL, listen_thread, NULL)) {
         pmix_ptl_base.listen_thread_active = false;
+        stop_handshake_threads();
         return PMIX_ERROR;
     }
 
@@ -131,6 +243,9 @@ void pmix_ptl_base_stop_listening(void)
     }
     /* wait for thread to exit */
     pthread_join(engine, NULL);
+    /* the listener can no longer feed them, so
+     * stop the handshake threads too */
+    stop_handshake_threads();
     /* close the socket to remove the connection points */
     CLOSE_THE_SOCKET(lt->socket);
     lt->socket = -1;
@@ -223,6 +338,14 @@ static void *listen_thread(void *obj)
         pmix_output_verbose(8, pmix_ptl_base_framework.framework_output,
                             "listen_thread: new connection: (%d, %d)", pending_connection->sd,
                             pmix_socket_errno);
+        if (0 < hs_nthreads) {
+            /* let a handshake thread read the request */
+            pthread_mutex_lock(&hs_lock);
+            pmix_list_append(&hs_queue, &pending_connection->super);
+            pthread_cond_signal(&hs_cond);
+            pthread_mutex_unlock(&hs_lock);
+            continue;
+        }
         /* post the object */
         PMIX_POST_OBJECT(pending_connection);
         /* activate the event */
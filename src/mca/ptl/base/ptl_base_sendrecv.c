@@ -38,6 +38,7 @@
 #ifdef HAVE_SYS_TYPES_H
 #    include <sys/types.h>
 #endif
+#include <limits.h>
 
 #include "src/class/pmix_pointer_array.h"
 #include "src/client/pmix_client_ops.h"
@@ -81,6 +82,13 @@ static void lost_connection(pmix_peer_t *peer)
         PMIX_RELEASE(peer->recv_msg);
         peer->recv_msg = NULL;
     }
+    /* anything left in the read-ahead buffer came from this socket */
+    if (NULL != peer->recv_buf) {
+        free(peer->recv_buf);
+        peer->recv_buf = NULL;
+        peer->recv_buf_start = 0;
+        peer->recv_buf_end = 0;
+    }
     CLOSE_THE_SOCKET(peer->sd);
     if (PMIX_PEER_IS_SERVER(pmix_globals.mypeer) &&
         !PMIX_PEER_IS_TOOL(pmix_globals.mypeer)) {
@@ -158,8 +166,7 @@ static void lost_connection(pmix_peer_t *peer)
                                                        trk->ninfo, NULL, 0,
                                                        trk->modexcbfunc, trk);
                         if (PMIX_SUCCESS != rc) {
-                            pmix_list_remove_item(&pmix_server_globals.collectives,
-                                                  &trk->super);
+                            pmix_server_trk_remove(trk);
                             PMIX_RELEASE(trk);
                         }
                     } else if (PMIX_CONNECTNB_CMD == trk->type) {
@@ -167,8 +174,7 @@ static void lost_connection(pmix_peer_t *peer)
                         rc = pmix_host_server.connect(trk->pcs, trk->npcs, trk->info,
                                                       trk->ninfo, trk->op_cbfunc, trk);
                         if (PMIX_SUCCESS != rc) {
-                            pmix_list_remove_item(&pmix_server_globals.collectives,
-                                                  &trk->super);
+                            pmix_server_trk_remove(trk);
                             PMIX_RELEASE(trk);
                         }
                     } else if (PMIX_DISCONNECTNB_CMD == trk->type) {
@@ -176,8 +182,7 @@ static void lost_connection(pmix_peer_t *peer)
                         rc = pmix_host_server.disconnect(trk->pcs, trk->npcs, trk->info,
                                                          trk->ninfo, trk->op_cbfunc, trk);
                         if (PMIX_SUCCESS != rc) {
-                            pmix_list_remove_item(&pmix_server_globals.collectives,
-                                                  &trk->super);
+                            pmix_server_trk_remove(trk);
                             PMIX_RELEASE(trk);
                         }
                     }
@@ -250,29 +255,138 @@ static void lost_connection(pmix_peer_t *peer)
     }
 }
 
-static pmix_status_t send_msg(int sd, pmix_ptl_send_t *msg)
+/* upper bound on the iovec we build for a single writev */
+#if defined(IOV_MAX) && IOV_MAX < 128
+#    define PMIX_PTL_SEND_MAX_IOV IOV_MAX
+#else
+#    define PMIX_PTL_SEND_MAX_IOV 128
+#endif
+
+/* number of bytes of the given msg that remain to be written */
+static size_t msg_remaining(pmix_ptl_send_t *msg)
 {
-    struct iovec iov[2];
-    int iov_count;
-    ssize_t remain = msg->sdbytes, rc;
-
-    iov[0].iov_base = msg->sdptr;
-    iov[0].iov_len = msg->sdbytes;
-    if (!msg->hdr_sent && NULL != msg->data) {
-        iov[1].iov_base = msg->data->base_ptr;
-        iov[1].iov_len = ntohl(msg->hdr.nbytes);
-        remain += ntohl(msg->hdr.nbytes);
-        iov_count = 2;
+    if (msg->hdr_sent || NULL == msg->data) {
+        return msg->sdbytes;
+    }
+    return msg->sdbytes + ntohl(msg->hdr.nbytes);
+}
+
+/* load an iovec entry for whatever part of a payload segment of len
+ * bytes, starting at wire position *pos, lies beyond offset */
+static int seg_load_iov(char *ptr, size_t len, size_t *pos, size_t offset, struct iovec *iov,
+                        size_t *nbytes)
+{
+    size_t skip = 0;
+    int n = 0;
+
+    if (0 < len && offset < *pos + len) {
+        if (*pos < offset) {
+            skip = offset - *pos;
+        }
+        iov->iov_base = ptr + skip;
+        iov->iov_len = len - skip;
+        *nbytes += len - skip;
+        n = 1;
+    }
+    *pos += len;
+    return n;
+}
+
+/* load the iovec entries describing the payload of a buffer from
+ * the given offset onwards, interleaving the packed data with any
+ * blocks the buffer references so the latter go out in place.
+ * Returns the number of entries used, which is at most maxiov */
+static int payload_load_iov(pmix_buffer_t *buf, size_t offset, struct iovec *iov, int maxiov,
+                            size_t *nbytes)
+{
+    pmix_buffer_ref_t *ref;
+    size_t pos = 0, prev = 0;
+    int n = 0;
+
+    *nbytes = 0;
+    if (NULL != buf->refs) {
+        PMIX_LIST_FOREACH (ref, buf->refs, pmix_buffer_ref_t) {
+            n += seg_load_iov(buf->base_ptr + prev, ref->offset - prev, &pos, offset, &iov[n],
+                              nbytes);
+            if (n == maxiov) {
+                return n;
+            }
+            n += seg_load_iov(ref->bytes, ref->size, &pos, offset, &iov[n], nbytes);
+            if (n == maxiov) {
+                return n;
+            }
+            prev = ref->offset;
+        }
+    }
+    n += seg_load_iov(buf->base_ptr + prev, buf->bytes_used - prev, &pos, offset, &iov[n], nbytes);
+    return n;
+}
+
+/* load the iovec entries describing what remains of the given msg,
+ * returning the number of entries used and the number of bytes they
+ * cover - the latter is less than msg_remaining if maxiov entries
+ * were not enough to describe all of it */
+static int msg_load_iov(pmix_ptl_send_t *msg, struct iovec *iov, int maxiov, size_t *nbytes)
+{
+    size_t offset, n;
+    int niov = 0;
+
+    *nbytes = 0;
+    if (!msg->hdr_sent) {
+        iov[0].iov_base = msg->sdptr;
+        iov[0].iov_len = msg->sdbytes;
+        *nbytes = msg->sdbytes;
+        niov = 1;
+        offset = 0;
     } else {
-        iov_count = 1;
+        offset = ntohl(msg->hdr.nbytes) - msg->sdbytes;
+    }
+    if (NULL != msg->data && niov < maxiov) {
+        niov += payload_load_iov(msg->data, offset, &iov[niov], maxiov - niov, &n);
+        *nbytes += n;
+    }
+    return niov;
+}
+
+/* account for nbytes of the given msg having been written, where
+ * nbytes is less than what remained of it. Once the header is out,
+ * sdbytes tracks the part of the payload still to be written */
+static void msg_advance(pmix_ptl_send_t *msg, size_t nbytes)
+{
+    if (!msg->hdr_sent) {
+        if (nbytes < msg->sdbytes) {
+            /* partial write of the header */
+            msg->sdptr = (char *) msg->sdptr + nbytes;
+            msg->sdbytes -= nbytes;
+            return;
+        }
+        /* header was fully written, but only a part of the msg data was written */
+        msg->hdr_sent = true;
+        nbytes -= msg->sdbytes;
+        msg->sdptr = NULL;
+        msg->sdbytes = (NULL == msg->data) ? 0 : ntohl(msg->hdr.nbytes);
     }
+    msg->sdbytes -= nbytes;
+}
+
+static pmix_status_t send_msg(int sd, pmix_ptl_send_t *msg)
+{
+    struct iovec iov[PMIX_PTL_SEND_MAX_IOV];
+    int iov_count;
+    size_t nbytes;
+    ssize_t remain = msg_remaining(msg), rc;
+
+    iov_count = msg_load_iov(msg, iov, PMIX_PTL_SEND_MAX_IOV, &nbytes);
 retry:
     rc = writev(sd, iov, iov_count);
+    if (0 < rc) {
+        ++pmix_ptl_base.send_syscalls;
+    }
     if (PMIX_LIKELY(rc == remain)) {
         /* we successfully sent the header and the msg data if any */
+        ++pmix_ptl_base.send_msgs;
         msg->hdr_sent = true;
         msg->sdbytes = 0;
-        msg->sdptr = (char *) iov[iov_count - 1].iov_base + iov[iov_count - 1].iov_len;
         return PMIX_SUCCESS;
     } else if (rc < 0) {
         if (pmix_socket_errno == EINTR) {
@@ -297,29 +411,96 @@ retry:
         }
     } else {
         /* short writev. This usually means the kernel buffer is full,
-         * so there is no point for retrying at that time.
+         * so there is no point for retrying at that time - it can also
+         * mean the msg has more segments than fit in one iovec, in
+         * which case the send event fires again right away.
          * simply update the msg and return with PMIX_ERR_RESOURCE_BUSY */
-        if ((size_t) rc < msg->sdbytes) {
-            /* partial write of the header or the msg data */
-            msg->sdptr = (char *) msg->sdptr + rc;
-            msg->sdbytes -= rc;
+        msg_advance(msg, rc);
+        return PMIX_ERR_RESOURCE_BUSY;
+    }
+}
+
+/* write the on-deck message along with as many of the messages queued
+ * behind it as fit within our limits using a single writev. Completed
+ * messages are released and, if a message is only partially written,
+ * it is left on-deck */
+static pmix_status_t send_coalesced(pmix_peer_t *peer)
+{
+    struct iovec iov[PMIX_PTL_SEND_MAX_IOV];
+    pmix_ptl_send_t *batch[PMIX_PTL_SEND_MAX_IOV / 2];
+    pmix_ptl_send_t *msg;
+    size_t nbytes, total = 0;
+    int maxmsgs, nmsgs = 0, niov = 0, n;
+    ssize_t rc;
+
+    maxmsgs = pmix_ptl_base.send_coalesce_max;
+    if (PMIX_PTL_SEND_MAX_IOV / 2 < maxmsgs) {
+        maxmsgs = PMIX_PTL_SEND_MAX_IOV / 2;
+    }
+    /* the on-deck message always goes - it may already be partially sent */
+    msg = peer->send_msg;
+    while (NULL != msg) {
+        niov += msg_load_iov(msg, &iov[niov], PMIX_PTL_SEND_MAX_IOV - niov, &nbytes);
+        batch[nmsgs++] = msg;
+        total += nbytes;
+        if (nbytes < msg_remaining(msg) || PMIX_PTL_SEND_MAX_IOV <= niov || nmsgs >= maxmsgs
+            || total >= pmix_ptl_base.send_coalesce_bytes) {
+            break;
+        }
+        if (1 == nmsgs) {
+            msg = (pmix_ptl_send_t *) pmix_list_get_first(&peer->send_queue);
         } else {
-            /* header was fully written, but only a part of the msg data was written */
-            msg->hdr_sent = true;
-            rc -= msg->sdbytes;
-            if (NULL != msg->data) {
-                /* technically, this should never happen as iov_count
-                 * would be 1 for a zero-byte message, and so we cannot
-                 * have a case where we write the header and part of the
-                 * msg. However, code checkers don't know that and are
-                 * fooled by our earlier check for NULL, and so
-                 * we silence their warnings by using this check */
-                msg->sdptr = (char *) msg->data->base_ptr + rc;
-            }
-            msg->sdbytes = ntohl(msg->hdr.nbytes) - rc;
+            msg = (pmix_ptl_send_t *) pmix_list_get_next(&msg->super);
         }
-        return PMIX_ERR_RESOURCE_BUSY;
+        if (pmix_list_get_end(&peer->send_queue) == &msg->super) {
+            break;
+        }
+    }
+
+retry:
+    rc = writev(peer->sd, iov, niov);
+    if (rc < 0) {
+        if (pmix_socket_errno == EINTR) {
+            goto retry;
+        } else if (pmix_socket_errno == EAGAIN) {
+            return PMIX_ERR_RESOURCE_BUSY;
+        } else if (pmix_socket_errno == EWOULDBLOCK) {
+            return PMIX_ERR_WOULD_BLOCK;
+        }
+        /* we hit an error and cannot progress these messages */
+        pmix_output(0, "pmix_ptl_base: send_coalesced: write failed: %s (%d) [sd = %d]",
+                    strerror(pmix_socket_errno), pmix_socket_errno, peer->sd);
+        return PMIX_ERR_UNREACH;
     }
+    ++pmix_ptl_base.send_syscalls;
+
+    /* retire the messages that went out in full - the first is
+     * on-deck and the rest are still at the head of the queue */
+    for (n = 0; n < nmsgs; n++) {
+        msg = batch[n];
+        nbytes = msg_remaining(msg);
+        if ((size_t) rc < nbytes) {
+            break;
+        }
+        rc -= nbytes;
+        if (0 < n) {
+            pmix_list_remove_item(&peer->send_queue, &msg->super);
+        }
+        PMIX_RELEASE(msg);
+        ++pmix_ptl_base.send_msgs;
+    }
+    if (n == nmsgs) {
+        peer->send_msg = NULL;
+        return PMIX_SUCCESS;
+    }
+    /* a short write - this usually means the kernel buffer is full,
+     * so put the partially sent message on-deck and wait */
+    msg_advance(msg, rc);
+    if (0 < n) {
+        pmix_list_remove_item(&peer->send_queue, &msg->super);
+        peer->send_msg = msg;
+    }
+    return PMIX_ERR_RESOURCE_BUSY;
 }
 
 static pmix_status_t read_bytes(int sd, char **buf, size_t *remain)
@@ -373,6 +554,12 @@ exit:
     return ret;
 }
 
+void pmix_ptl_base_get_send_stats(uint64_t *nmsgs, uint64_t *nsyscalls)
+{
+    *nmsgs = pmix_ptl_base.send_msgs;
+    *nsyscalls = pmix_ptl_base.send_syscalls;
+}
+
 /*
  * A file descriptor is available/ready for send. Check the state
  * of the socket and take the appropriate action.
@@ -397,12 +584,19 @@ void pmix_ptl_base_send_handler(int sd, short flags, void *cbdata)
         pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
                             "ptl:base:send_handler SENDING MSG TO %s TAG %u",
                             PMIX_PNAME_PRINT(&peer->info->pname), ntohl(msg->hdr.tag));
-        if (PMIX_SUCCESS == (rc = send_msg(peer->sd, msg))) {
+        if (1 < pmix_ptl_base.send_coalesce_max && !pmix_list_is_empty(&peer->send_queue)) {
+            /* send as much of the backlog as we can in one go - this
+             * releases whatever it completes */
+            rc = send_coalesced(peer);
+            msg = peer->send_msg;
+        } else if (PMIX_SUCCESS == (rc = send_msg(peer->sd, msg))) {
+            PMIX_RELEASE(msg);
+            peer->send_msg = NULL;
+        }
+        if (PMIX_SUCCESS == rc) {
             // message is complete
             pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
                                 "ptl:base:send_handler MSG SENT");
-            PMIX_RELEASE(msg);
-            peer->send_msg = NULL;
         } else if (PMIX_ERR_RESOURCE_BUSY == rc || PMIX_ERR_WOULD_BLOCK == rc) {
             /* exit this event and let the event lib progress */
             pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
@@ -445,6 +639,129 @@ void pmix_ptl_base_send_handler(int sd, short flags, void *cbdata)
     PMIX_POST_OBJECT(peer);
 }
 
+/*
+ * Read-ahead flavor of the recv handler: pull in whatever the socket
+ * has available with a single read into the peer's read-ahead buffer
+ * and deliver every complete message found in it. Each message still gets its own data region as the
+ * buffer it is delivered in takes ownership of it. When a message is
+ * too large to fit, the rest of its body is read directly into its
+ * data region on subsequent events.
+ */
+static pmix_status_t recv_buffered(pmix_peer_t *peer)
+{
+    pmix_ptl_recv_t *msg;
+    pmix_ptl_hdr_t hdr;
+    size_t avail, n;
+    ssize_t rc;
+    pmix_status_t ret;
+
+    /* finish any message whose body we are reading directly */
+    if (NULL != peer->recv_msg) {
+        msg = peer->recv_msg;
+        ret = read_bytes(peer->sd, &msg->rdptr, &msg->rdbytes);
+        if (PMIX_SUCCESS != ret) {
+            return ret;
+        }
+        PMIX_ACTIVATE_POST_MSG(msg);
+        peer->recv_msg = NULL;
+    }
+
+    if (NULL == peer->recv_buf) {
+        peer->recv_buf = (char *) malloc(pmix_ptl_base.recv_buffer_size);
+        if (NULL == peer->recv_buf) {
+            return PMIX_ERR_NOMEM;
+        }
+        peer->recv_buf_start = 0;
+        peer->recv_buf_end = 0;
+    } else if (0 < peer->recv_buf_start) {
+        /* slide the partial header we kept to the front */
+        memmove(peer->recv_buf, peer->recv_buf + peer->recv_buf_start,
+                peer->recv_buf_end - peer->recv_buf_start);
+        peer->recv_buf_end -= peer->recv_buf_start;
+        peer->recv_buf_start = 0;
+    }
+
+retry:
+    rc = read(peer->sd, peer->recv_buf + peer->recv_buf_end,
+              pmix_ptl_base.recv_buffer_size - peer->recv_buf_end);
+    if (rc < 0) {
+        if (pmix_socket_errno == EINTR) {
+            goto retry;
+        } else if (pmix_socket_errno == EAGAIN) {
+            return PMIX_ERR_RESOURCE_BUSY;
+        } else if (pmix_socket_errno == EWOULDBLOCK) {
+            return PMIX_ERR_WOULD_BLOCK;
+        }
+        pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                            "pmix_ptl_base_msg_recv: read failed: %s (%d)",
+                            strerror(pmix_socket_errno), pmix_socket_errno);
+        return PMIX_ERR_UNREACH;
+    } else if (0 == rc) {
+        /* the remote peer closed the connection */
+        return PMIX_ERR_UNREACH;
+    }
+    peer->recv_buf_end += rc;
+
+    /* deliver everything that is complete */
+    while (sizeof(pmix_ptl_hdr_t) <= peer->recv_buf_end - peer->recv_buf_start) {
+        memcpy(&hdr, peer->recv_buf + peer->recv_buf_start, sizeof(pmix_ptl_hdr_t));
+        peer->recv_buf_start += sizeof(pmix_ptl_hdr_t);
+
+        msg = PMIX_NEW(pmix_ptl_recv_t);
+        if (NULL == msg) {
+            return PMIX_ERR_NOMEM;
+        }
+        PMIX_RETAIN(peer);
+        msg->peer = peer;
+        msg->sd = peer->sd;
+        msg->hdr_recvd = true;
+        msg->hdr.pindex = ntohl(hdr.pindex);
+        msg->hdr.tag = ntohl(hdr.tag);
+        msg->hdr.nbytes = ntohl(hdr.nbytes);
+        pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                            "%s RECVD MSG FROM %s FOR TAG %d SIZE %d",
+                            PMIX_NAME_PRINT(&pmix_globals.myid),
+                            PMIX_PNAME_PRINT(&peer->info->pname), (int) msg->hdr.tag,
+                            (int) msg->hdr.nbytes);
+        if (0 == msg->hdr.nbytes) {
+            PMIX_ACTIVATE_POST_MSG(msg);
+            continue;
+        }
+        if (0 < pmix_ptl_base.max_msg_size && pmix_ptl_base.max_msg_size < msg->hdr.nbytes) {
+            pmix_show_help("help-pmix-runtime.txt", "ptl:msg_size", true,
+                           (unsigned long) msg->hdr.nbytes,
+                           (unsigned long) pmix_ptl_base.max_msg_size);
+            PMIX_RELEASE(msg);
+            return PMIX_ERR_UNREACH;
+        }
+        msg->data = (char *) malloc(msg->hdr.nbytes);
+        if (NULL == msg->data) {
+            PMIX_RELEASE(msg);
+            return PMIX_ERR_NOMEM;
+        }
+        avail = peer->recv_buf_end - peer->recv_buf_start;
+        n = (avail < msg->hdr.nbytes) ? avail : msg->hdr.nbytes;
+        memcpy(msg->data, peer->recv_buf + peer->recv_buf_start, n);
+        peer->recv_buf_start += n;
+        if (n == msg->hdr.nbytes) {
+            PMIX_ACTIVATE_POST_MSG(msg);
+            continue;
+        }
+        /* the rest has yet to arrive - we consumed all we had */
+        msg->rdptr = msg->data + n;
+        msg->rdbytes = msg->hdr.nbytes - n;
+        peer->recv_msg = msg;
+    }
+
+    /* keep the buffer for the next event on this connection - it
+     * is released along with the peer */
+    if (peer->recv_buf_start == peer->recv_buf_end) {
+        peer->recv_buf_start = 0;
+        peer->recv_buf_end = 0;
+    }
+    return PMIX_SUCCESS;
+}
+
 /*
  * Dispatch to the appropriate action routine based on the state
  * of the connection with the peer.
@@ -472,6 +789,20 @@ void pmix_ptl_base_recv_handler(int sd, short flags, void *cbdata)
     if (NULL == peer) {
         return;
     }
+    if (0 < pmix_ptl_base.recv_buffer_size) {
+        rc = recv_buffered(peer);
+        if (PMIX_SUCCESS == rc || PMIX_ERR_RESOURCE_BUSY == rc || PMIX_ERR_WOULD_BLOCK == rc) {
+            /* ensure we post the modified peer object before another thread
+             * picks it back up */
+            PMIX_POST_OBJECT(peer);
+            return;
+        }
+        pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
+                            "%s ptl:base:msg_recv: peer %s closed connection",
+                            PMIX_NAME_PRINT(&pmix_globals.myid),
+                            PMIX_PNAME_PRINT(&peer->info->pname));
+        goto err_close;
+    }
     /* allocate a new message and setup for recv */
     if (NULL == peer->recv_msg) {
         pmix_output_verbose(2, pmix_ptl_base_framework.framework_output,
@@ -653,6 +984,8 @@ void pmix_ptl_base_send(int sd, short args, void *cbdata)
         msg->hdr.pindex = pmix_globals.pindex;
         msg->hdr.tag = queue->tag;
         if (NULL != queue->buf) {
+            /* the recv side needs the payload in one piece */
+            pmix_bfrops_base_flatten(queue->buf);
             msg->hdr.nbytes = (queue->buf)->bytes_used;
             msg->data = (queue->buf)->base_ptr;
             (queue->buf)->base_ptr = NULL;
@@ -678,7 +1011,7 @@ void pmix_ptl_base_send(int sd, short args, void *cbdata)
     snd = PMIX_NEW(pmix_ptl_send_t);
     snd->hdr.pindex = htonl(pmix_globals.pindex);
     snd->hdr.tag = htonl(queue->tag);
-    snd->hdr.nbytes = htonl((queue->buf)->bytes_used);
+    snd->hdr.nbytes = htonl(PMIX_BUFFER_PAYLOAD_SIZE(queue->buf));
     snd->data = (queue->buf);
     /* always start with the header */
     snd->sdptr = (char *) &snd->hdr;
@@ -763,6 +1096,8 @@ void pmix_ptl_base_send_recv(int fd, short args, void *cbdata)
         msg->peer = ms->peer;
         msg->hdr.pindex = pmix_globals.pindex;
         msg->hdr.tag = tag;
+        /* the recv side needs the payload in one piece */
+        pmix_bfrops_base_flatten(ms->bfr);
         msg->hdr.nbytes = ms->bfr->bytes_used;
         msg->data = ms->bfr->base_ptr;
         ms->bfr->base_ptr = NULL;
@@ -775,7 +1110,7 @@ void pmix_ptl_base_send_recv(int fd, short args, void *cbdata)
     snd = PMIX_NEW(pmix_ptl_send_t);
     snd->hdr.pindex = htonl(pmix_globals.pindex);
     snd->hdr.tag = htonl(tag);
-    snd->hdr.nbytes = htonl(ms->bfr->bytes_used);
+    snd->hdr.nbytes = htonl(PMIX_BUFFER_PAYLOAD_SIZE(ms->bfr));
     snd->data = ms->bfr;
     /* always start with the header */
     snd->sdptr = (char *) &snd->hdr;
@@ -290,7 +290,7 @@ typedef uint16_t pmix_listener_protocol_t;
 
 /* connection support */
 typedef struct {
-    pmix_object_t super;
+    pmix_list_item_t super;
     pmix_event_t ev;
     pmix_listener_protocol_t protocol;
     int sd;
@@ -312,6 +312,11 @@ typedef struct {
     uid_t uid;
     gid_t gid;
     pmix_proc_type_t proc_type;
+    /* set once the connection request has been read and parsed,
+     * possibly by a handshake thread */
+    bool preread;
+    char *blob;
+    size_t bloblen;
 } pmix_pending_connection_t;
 PMIX_CLASS_DECLARATION(pmix_pending_connection_t);
 
@@ -384,7 +389,7 @@ PMIX_EXPORT extern int pmix_ptl_base_output;
             snd = PMIX_NEW(pmix_ptl_send_t);                                                    \
             snd->hdr.pindex = htonl(pmix_globals.pindex);                                       \
             snd->hdr.tag = htonl(t);                                                            \
-            nbytes = (b)->bytes_used;                                                           \
+            nbytes = PMIX_BUFFER_PAYLOAD_SIZE(b);                                               \
             snd->hdr.nbytes = htonl(nbytes);                                                    \
             snd->data = (b);                                                                    \
             /* always start with the header */                                                  \
@@ -120,6 +120,8 @@ void pmix_rte_finalize(void)
     PMIX_RELEASE(pmix_globals.mypeer);
     PMIX_DESTRUCT(&pmix_globals.events);
     PMIX_LIST_DESTRUCT(&pmix_globals.cached_events);
+    PMIX_DESTRUCT(&pmix_globals.cached_events_index);
+    PMIX_DESTRUCT(&pmix_globals.coalesced_procs);
     /* clear any notifications */
     for (i = 0; i < pmix_globals.max_events; i++) {
         pmix_hotel_checkout_and_return_occupant(&pmix_globals.notifications, i, (void **) &cd);
@@ -128,6 +130,9 @@ void pmix_rte_finalize(void)
         }
     }
     PMIX_DESTRUCT(&pmix_globals.notifications);
+    pmix_globals.oldest_notification = NULL;
+    pmix_globals.newest_notification = NULL;
+    PMIX_DESTRUCT(&pmix_globals.notifications_index);
     for (i = 0; i < pmix_globals.iof_requests.size; i++) {
         req = (pmix_iof_req_t *) pmix_pointer_array_get_item(&pmix_globals.iof_requests, i);
         if (NULL != req) {
@@ -141,6 +146,7 @@ void pmix_rte_finalize(void)
         pmix_globals.hostname = NULL;
     }
     PMIX_LIST_DESTRUCT(&pmix_globals.nspaces);
+    PMIX_DESTRUCT(&pmix_globals.nspace_index);
     for (i=0; i < pmix_globals.keyindex.size; i++) {
         p = (pmix_regattr_input_t*)pmix_pointer_array_get_item(&pmix_globals.keyindex, i);
         if (NULL != p) {
@@ -157,6 +163,7 @@ void pmix_rte_finalize(void)
         }
     }
     PMIX_DESTRUCT(&pmix_globals.keyindex);
+    PMIX_DESTRUCT(&pmix_globals.keytable);
 
     /* now safe to release the event base */
     (void) pmix_progress_thread_stop(NULL);
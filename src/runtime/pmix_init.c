@@ -97,10 +97,16 @@ PMIX_EXPORT pmix_globals_t pmix_globals = {
     .commits_pending = false,
     .event_window = {0, 0},
     .cached_events = PMIX_LIST_STATIC_INIT,
+    .cached_events_index = PMIX_HASH_TABLE_STATIC_INIT,
+    .coalesced_procs = PMIX_HASH_TABLE_STATIC_INIT,
+    .events_coalesced = 0,
     .iof_requests = PMIX_POINTER_ARRAY_STATIC_INIT,
     .max_events = INT_MAX,
     .event_eviction_time = 0,
     .notifications = PMIX_HOTEL_STATIC_INIT,
+    .oldest_notification = NULL,
+    .newest_notification = NULL,
+    .notifications_index = PMIX_HASH_TABLE_STATIC_INIT,
     .pushstdin = false,
     .stdin_targets = PMIX_LIST_STATIC_INIT,
     .tag_output = false,
@@ -108,12 +114,14 @@ PMIX_EXPORT pmix_globals_t pmix_globals = {
     .timestamp_output = false,
     .output_limit = SIZE_MAX,
     .nspaces = PMIX_LIST_STATIC_INIT,
+    .nspace_index = PMIX_HASH_TABLE_STATIC_INIT,
     .topology = {NULL, NULL},
     .cpuset = {NULL, NULL},
     .external_topology = false,
     .external_progress = false,
     .iof_flags = PMIX_IOF_FLAGS_STATIC_INIT,
     .keyindex = PMIX_POINTER_ARRAY_STATIC_INIT,
+    .keytable = PMIX_HASH_TABLE_STATIC_INIT,
     .next_keyid = PMIX_INDEX_BOUNDARY
 };
 
@@ -122,6 +130,8 @@ static void _notification_eviction_cbfunc(struct pmix_hotel_t *hotel, int room_n
     pmix_notify_caddy_t *cache = (pmix_notify_caddy_t *) occupant;
     PMIX_HIDE_UNUSED_PARAMS(hotel, room_num);
 
+    /* the hotel has already emptied the room */
+    pmix_notify_event_unlink(cache);
     PMIX_RELEASE(cache);
 }
 
@@ -301,13 +311,23 @@ int pmix_rte_init(uint32_t type, pmix_info_t info[], size_t ninfo, pmix_ptl_cbfu
     pmix_globals.event_window.tv_sec = pmix_event_caching_window;
     pmix_globals.event_window.tv_usec = 0;
     PMIX_CONSTRUCT(&pmix_globals.cached_events, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_globals.cached_events_index, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_globals.cached_events_index, 32);
+    PMIX_CONSTRUCT(&pmix_globals.coalesced_procs, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_globals.coalesced_procs, 256);
     /* construct the global notification ring buffer */
     PMIX_CONSTRUCT(&pmix_globals.notifications, pmix_hotel_t);
     ret = pmix_hotel_init(&pmix_globals.notifications, pmix_globals.max_events, pmix_globals.evbase,
                           pmix_globals.event_eviction_time, _notification_eviction_cbfunc);
+    PMIX_CONSTRUCT(&pmix_globals.notifications_index, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_globals.notifications_index, 32);
     PMIX_CONSTRUCT(&pmix_globals.nspaces, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_globals.nspace_index, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_globals.nspace_index, 256);
     PMIX_CONSTRUCT(&pmix_globals.keyindex, pmix_pointer_array_t);
     pmix_pointer_array_init(&pmix_globals.keyindex, 1024, INT_MAX, 128);
+    PMIX_CONSTRUCT(&pmix_globals.keytable, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_globals.keytable, 1024);
     /* need to hold off checking the hotel init return code
      * until after we construct all the globals so they can
      * correctly finalize */
@@ -48,6 +48,7 @@ bool pmix_timing_overhead = true;
 static bool pmix_register_done = false;
 char *pmix_net_private_ipv4 = NULL;
 int pmix_event_caching_window = 1;
+bool pmix_event_coalesce = false;
 bool pmix_suppress_missing_data_warning = false;
 char *pmix_progress_thread_cpus = NULL;
 bool pmix_bind_progress_thread_reqd = false;
@@ -109,6 +110,14 @@ pmix_status_t pmix_register_params(void)
         PMIX_MCA_BASE_VAR_TYPE_INT,
         &pmix_event_caching_window);
 
+    (void) pmix_mca_base_var_register(
+        "pmix", "pmix", NULL, "event_coalesce",
+        "Merge events received with the same status and range within the event "
+        "caching window into a single event whose affected procs are the union of "
+        "theirs, so that handlers run once per window instead of once per event",
+        PMIX_MCA_BASE_VAR_TYPE_BOOL,
+        &pmix_event_coalesce);
+
     (void) pmix_mca_base_var_register("pmix", "pmix", NULL, "suppress_missing_data_warning",
                                       "Suppress warning that PMIx is missing job-level data that "
                                       "is supposed to be provided by the host RM.",
@@ -116,6 +125,15 @@ pmix_status_t pmix_register_params(void)
                                       &pmix_suppress_missing_data_warning);
 
 
+    pmix_client_globals.get_cache = false;
+    (void) pmix_mca_base_var_register("pmix", "pmix", "client", "get_cache",
+                                      "Remember keys the server reported as not found and answer "
+                                      "later PMIx_Get requests for them locally until the next "
+                                      "fence, commit, or event notification. Can be overridden "
+                                      "on each call with PMIX_GET_CACHE (default: false)",
+                                      PMIX_MCA_BASE_VAR_TYPE_BOOL,
+                                      &pmix_client_globals.get_cache);
+
     /****   CLIENT: VERBOSE OUTPUT PARAMS   ****/
     (void) pmix_mca_base_var_register("pmix", "pmix", "client", "get_verbose",
                                       "Verbosity for client get operations",
@@ -207,6 +225,38 @@ pmix_status_t pmix_register_params(void)
         PMIX_MCA_BASE_VAR_TYPE_BOOL,
         &pmix_server_globals.fence_localonly_opt);
 
+    pmix_server_globals.dmodex_batch_window = 0;
+    (void) pmix_mca_base_var_register(
+        "pmix", "pmix", "server", "dmodex_batch_window",
+        "Time in usec to collect direct modex requests for remote procs so that those "
+        "bound for the same host can be passed up in a single request. The host must "
+        "support PMIX_DMODEX_PROCS (default: 0 - pass each request up immediately)",
+        PMIX_MCA_BASE_VAR_TYPE_INT,
+        &pmix_server_globals.dmodex_batch_window);
+
+    pmix_server_globals.dmodex_batch_max = 64;
+    (void) pmix_mca_base_var_register(
+        "pmix", "pmix", "server", "dmodex_batch_max",
+        "Pass collected direct modex requests up once this many are waiting (default: 64)",
+        PMIX_MCA_BASE_VAR_TYPE_INT,
+        &pmix_server_globals.dmodex_batch_max);
+
+    pmix_server_globals.dmodex_prefetch_depth = 0;
+    (void) pmix_mca_base_var_register(
+        "pmix", "pmix", "server", "dmodex_prefetch_depth",
+        "Number of ranks whose data is requested ahead of a sequential or strided "
+        "pattern of direct modex requests within a namespace (default: 0 - no prefetch)",
+        PMIX_MCA_BASE_VAR_TYPE_INT,
+        &pmix_server_globals.dmodex_prefetch_depth);
+
+    pmix_server_globals.dmodex_prefetch_window = 3;
+    (void) pmix_mca_base_var_register(
+        "pmix", "pmix", "server", "dmodex_prefetch_window",
+        "Number of consecutive direct modex requests within a namespace that must share "
+        "the same rank stride before prefetching begins (default: 3)",
+        PMIX_MCA_BASE_VAR_TYPE_INT,
+        &pmix_server_globals.dmodex_prefetch_window);
+
     /* check for maximum number of pending output messages */
     pmix_globals.output_limit = (size_t) INT_MAX;
     (void) pmix_mca_base_var_register("pmix", "iof", NULL, "output_limit",
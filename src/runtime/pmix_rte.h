@@ -47,6 +47,7 @@ PMIX_EXPORT extern bool pmix_timing_overhead;
 
 PMIX_EXPORT extern char *pmix_net_private_ipv4;
 PMIX_EXPORT extern int pmix_event_caching_window;
+PMIX_EXPORT extern bool pmix_event_coalesce;
 PMIX_EXPORT extern bool pmix_suppress_missing_data_warning;
 PMIX_EXPORT extern char *pmix_progress_thread_cpus;
 PMIX_EXPORT extern bool pmix_bind_progress_thread_reqd;
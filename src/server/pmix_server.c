@@ -86,11 +86,17 @@ pmix_server_globals_t pmix_server_globals = {
     .nspaces = PMIX_LIST_STATIC_INIT,
     .clients = PMIX_POINTER_ARRAY_STATIC_INIT,
     .collectives = PMIX_LIST_STATIC_INIT,
-    .remote_pnd = PMIX_LIST_STATIC_INIT,
+    .colltable = PMIX_HASH_TABLE_STATIC_INIT,
+    .remote_pnd = PMIX_HASH_TABLE_STATIC_INIT,
     .local_reqs = PMIX_LIST_STATIC_INIT,
+    .local_reqs_index = PMIX_HASH_TABLE_STATIC_INIT,
+    .prefetched = PMIX_HASH_TABLE_STATIC_INIT,
+    .dmdx_batches = PMIX_LIST_STATIC_INIT,
+    .dmdx_streams = PMIX_LIST_STATIC_INIT,
     .gdata = PMIX_LIST_STATIC_INIT,
     .genvars = NULL,
     .events = PMIX_LIST_STATIC_INIT,
+    .events_index = PMIX_HASH_TABLE_STATIC_INIT,
     .groups = PMIX_LIST_STATIC_INIT,
     .iof = PMIX_LIST_STATIC_INIT,
     .iof_residuals = PMIX_LIST_STATIC_INIT,
@@ -100,6 +106,12 @@ pmix_server_globals_t pmix_server_globals = {
     .tmpdir = NULL,
     .system_tmpdir = NULL,
     .fence_localonly_opt = false,
+    .dmodex_batch_window = 0,
+    .dmodex_batch_max = 64,
+    .dmodex_prefetch_depth = 0,
+    .dmodex_prefetch_window = 3,
+    .dmodex_prefetch_hits = 0,
+    .dmodex_prefetch_misses = 0,
     .get_output = -1,
     .get_verbose = 0,
     .connect_output = -1,
@@ -317,7 +329,7 @@ static void debugger_aggregator(size_t evhdlr_registration_id, pmix_status_t sta
 {
     pmix_proc_t proc;
     pmix_status_t rc;
-    pmix_namespace_t *ns, *nptr;
+    pmix_namespace_t *nptr;
 
     pmix_output_verbose(2, pmix_server_globals.base_output,
                         "[%s:%d] DEBUGGER AGGREGATOR CALLED FOR NSPACE %s",
@@ -326,13 +338,7 @@ static void debugger_aggregator(size_t evhdlr_registration_id, pmix_status_t sta
     PMIX_HIDE_UNUSED_PARAMS(evhdlr_registration_id, results, nresults);
 
     /* find the nspace tracker for this namespace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(ns->nspace, source->nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(source->nspace);
     if (NULL == nptr) {
         /* only can happen if there is an error - nothing we can do*/
         goto done;
@@ -377,7 +383,7 @@ static pmix_status_t register_singleton(char *name)
     nptr->nspace = strdup(tmp);
     nptr->nlocalprocs = 1;
     nptr->nprocs = 1;
-    pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+    pmix_nspace_add(nptr);
     /* add this rank */
     rinfo = PMIX_NEW(pmix_rank_info_t);
     if (NULL == rinfo) {
@@ -405,10 +411,21 @@ pmix_status_t pmix_server_initialize(void)
     pmix_pointer_array_init(&pmix_server_globals.clients, 1, INT_MAX, 1);
     PMIX_CONSTRUCT(&pmix_server_globals.nspaces, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_server_globals.collectives, pmix_list_t);
-    PMIX_CONSTRUCT(&pmix_server_globals.remote_pnd, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_server_globals.colltable, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_server_globals.colltable, 32);
+    PMIX_CONSTRUCT(&pmix_server_globals.remote_pnd, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_server_globals.remote_pnd, 256);
     PMIX_CONSTRUCT(&pmix_server_globals.local_reqs, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_server_globals.local_reqs_index, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_server_globals.local_reqs_index, 256);
+    PMIX_CONSTRUCT(&pmix_server_globals.prefetched, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_server_globals.prefetched, 256);
+    PMIX_CONSTRUCT(&pmix_server_globals.dmdx_batches, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_server_globals.dmdx_streams, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_server_globals.gdata, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_server_globals.events, pmix_list_t);
+    PMIX_CONSTRUCT(&pmix_server_globals.events_index, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_server_globals.events_index, 32);
     PMIX_CONSTRUCT(&pmix_server_globals.groups, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_server_globals.iof, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_server_globals.iof_residuals, pmix_list_t);
@@ -733,11 +750,13 @@ PMIX_EXPORT pmix_status_t PMIx_server_init(pmix_server_module_t *module, pmix_in
     }
     if (NULL == pmix_globals.mypeer->nptr) {
         pmix_globals.mypeer->nptr = PMIX_NEW(pmix_namespace_t);
+        pmix_globals.mypeer->nptr->nspace = strdup(pmix_globals.myid.nspace);
         /* ensure our own nspace is first on the list */
         PMIX_RETAIN(pmix_globals.mypeer->nptr);
-        pmix_list_prepend(&pmix_globals.nspaces, &pmix_globals.mypeer->nptr->super);
+        pmix_nspace_prepend(pmix_globals.mypeer->nptr);
+    } else {
+        pmix_globals.mypeer->nptr->nspace = strdup(pmix_globals.myid.nspace);
     }
-    pmix_globals.mypeer->nptr->nspace = strdup(pmix_globals.myid.nspace);
     rinfo->pname.nspace = strdup(pmix_globals.mypeer->nptr->nspace);
     rinfo->pname.rank = pmix_globals.myid.rank;
     rinfo->uid = pmix_globals.uid;
@@ -1003,10 +1022,17 @@ PMIX_EXPORT pmix_status_t PMIx_server_finalize(void)
     }
     PMIX_DESTRUCT(&pmix_server_globals.clients);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.collectives);
-    PMIX_LIST_DESTRUCT(&pmix_server_globals.remote_pnd);
+    PMIX_DESTRUCT(&pmix_server_globals.colltable);
+    pmix_dmdx_remote_purge();
+    pmix_dmdx_batch_purge();
+    pmix_dmdx_prefetch_purge();
+    PMIX_DESTRUCT(&pmix_server_globals.remote_pnd);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.local_reqs);
+    PMIX_DESTRUCT(&pmix_server_globals.local_reqs_index);
+    PMIX_DESTRUCT(&pmix_server_globals.prefetched);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.gdata);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.events);
+    PMIX_DESTRUCT(&pmix_server_globals.events_index);
     PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
         /* ensure that we do the specified cleanup - if this is an
          * abnormal termination, then the nspace object may not be
@@ -1065,7 +1091,7 @@ static void opcbfunc(pmix_status_t status, void *cbdata)
 static void _register_nspace(int sd, short args, void *cbdata)
 {
     pmix_setup_caddy_t *cd = (pmix_setup_caddy_t *) cbdata;
-    pmix_namespace_t *nptr, *tmp;
+    pmix_namespace_t *nptr;
     pmix_status_t rc;
     size_t i, m, ninfo;
     pmix_info_t *iptr;
@@ -1085,13 +1111,7 @@ static void _register_nspace(int sd, short args, void *cbdata)
     PMIX_HIDE_UNUSED_PARAMS(sd, args);
 
     /* see if we already have this nspace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(tmp->nspace, cd->proc.nspace)) {
-            nptr = tmp;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(cd->proc.nspace);
     if (NULL == nptr) {
         nptr = PMIX_NEW(pmix_namespace_t);
         if (NULL == nptr) {
@@ -1099,7 +1119,7 @@ static void _register_nspace(int sd, short args, void *cbdata)
             goto release;
         }
         nptr->nspace = strdup(cd->proc.nspace);
-        pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+        pmix_nspace_add(nptr);
     }
     if (0 > cd->nlocalprocs) {
         gds = nptr->compat.gds;
@@ -1191,13 +1211,9 @@ static void _register_nspace(int sd, short args, void *cbdata)
              * if the nspaces are all completely registered */
             if (all_def) {
                 /* so far, they have all been defined - check this one */
-                PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-                    if (0 == strcmp(trk->pcs[i].nspace, ns->nspace)) {
-                        if (SIZE_MAX == ns->nlocalprocs || !ns->all_registered) {
-                            all_def = false;
-                        }
-                        break;
-                    }
+                ns = pmix_nspace_lookup(trk->pcs[i].nspace);
+                if (NULL != ns && (SIZE_MAX == ns->nlocalprocs || !ns->all_registered)) {
+                    all_def = false;
                 }
             }
             /* now see if this nspace is the one we just registered */
@@ -1297,7 +1313,7 @@ void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc)
     pmix_peer_events_info_t *prev, *pnext;
     pmix_iof_req_t *req;
     int i;
-    pmix_notify_caddy_t *ncd;
+    pmix_notify_caddy_t *ncd, *nnext;
     size_t n, m, p, ntgs;
     pmix_proc_t *tgs, *tgt;
     pmix_dmdx_local_t *dlcd, *dnxt;
@@ -1305,15 +1321,15 @@ void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc)
     /* since the client is finalizing, remove them from any event
      * registrations they may still have on our list */
     PMIX_LIST_FOREACH_SAFE (reginfo, regnext, &pmix_server_globals.events, pmix_regevents_info_t) {
+        if (NULL != peer && NULL == proc
+            && !pmix_bitmap_is_set_bit(&reginfo->subscribers, peer->index)) {
+            continue;
+        }
         PMIX_LIST_FOREACH_SAFE (prev, pnext, &reginfo->peers, pmix_peer_events_info_t) {
             if ((NULL != peer && prev->peer == peer)
                 || (NULL != proc && NULL != prev->peer->info
                     && PMIX_CHECK_PROCID(proc, &prev->peer->info->pname))) {
-                pmix_list_remove_item(&reginfo->peers, &prev->super);
-                PMIX_RELEASE(prev);
-                if (0 == pmix_list_get_size(&reginfo->peers)) {
-                    pmix_list_remove_item(&pmix_server_globals.events, &reginfo->super);
-                    PMIX_RELEASE(reginfo);
+                if (pmix_server_event_reg_remove(reginfo, prev)) {
                     break;
                 }
             }
@@ -1351,7 +1367,7 @@ void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc)
              && PMIX_CHECK_PROCID(&peer->info->pname, &dlcd->proc))
             || (NULL != proc && PMIX_CHECK_PROCID(proc, &dlcd->proc))) {
             /* cleanup this request */
-            pmix_list_remove_item(&pmix_server_globals.local_reqs, &dlcd->super);
+            pmix_dmdx_local_remove(dlcd);
             /* we can release the dlcd item here because we are not
              * releasing the tracker held by the host - we are only
              * releasing one item on that tracker */
@@ -1360,9 +1376,9 @@ void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc)
     }
 
     /* purge this client from any cached notifications */
-    for (i = 0; i < pmix_globals.max_events; i++) {
-        pmix_hotel_knock(&pmix_globals.notifications, i, (void **) &ncd);
-        if (NULL != ncd && NULL != ncd->targets && 0 < ncd->ntargets) {
+    for (ncd = pmix_globals.oldest_notification; NULL != ncd; ncd = nnext) {
+        nnext = ncd->newer;
+        if (NULL != ncd->targets && 0 < ncd->ntargets) {
             tgt = NULL;
             for (n = 0; n < ncd->ntargets; n++) {
                 if ((NULL != peer && NULL != peer->info
@@ -1376,7 +1392,7 @@ void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc)
                 /* if this client was the only target, then just
                  * evict the notification */
                 if (1 == ncd->ntargets) {
-                    pmix_hotel_checkout(&pmix_globals.notifications, i);
+                    pmix_notify_event_uncache(ncd);
                     PMIX_RELEASE(ncd);
                 } else if (PMIX_RANK_WILDCARD == tgt->rank && NULL != proc
                            && PMIX_RANK_WILDCARD == proc->rank) {
@@ -1435,16 +1451,17 @@ static void _deregister_nspace(int sd, short args, void *cbdata)
      * cached notifications targeting procs from this nspace */
     pmix_server_purge_events(NULL, &cd->proc);
 
+    /* forget any dmodex prefetching we were doing for it */
+    pmix_dmdx_prefetch_purge_nspace(cd->proc.nspace);
+
     /* release this nspace */
-    PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (PMIX_CHECK_NSPACE(tmp->nspace, cd->proc.nspace)) {
-            /* perform any nspace-level epilog */
-            pmix_execute_epilog(&tmp->epilog);
-            /* remove and release it */
-            pmix_list_remove_item(&pmix_globals.nspaces, &tmp->super);
-            PMIX_RELEASE(tmp);
-            break;
-        }
+    tmp = pmix_nspace_lookup(cd->proc.nspace);
+    if (NULL != tmp) {
+        /* perform any nspace-level epilog */
+        pmix_execute_epilog(&tmp->epilog);
+        /* remove and release it */
+        pmix_nspace_remove(tmp);
+        PMIX_RELEASE(tmp);
     }
 
     /* release the caller */
@@ -1773,7 +1790,7 @@ void pmix_server_execute_collective(int sd, short args, void *cbdata)
     } else {
         /* unknown type */
         PMIX_ERROR_LOG(PMIX_ERR_NOT_FOUND);
-        pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+        pmix_server_trk_remove(trk);
         PMIX_RELEASE(trk);
     }
     PMIX_RELEASE(tcd);
@@ -1799,13 +1816,7 @@ static void _register_client(int sd, short args, void *cbdata)
                         (NULL == cd->server_object) ? "NULL" : "NON-NULL");
 
     /* see if we already have this nspace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(ns->nspace, cd->proc.nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(cd->proc.nspace);
     if (NULL == nptr) {
         /* there is no requirement in the Standard that hosts register
          * an nspace prior to registering clients for that nspace. So
@@ -1817,7 +1828,7 @@ static void _register_client(int sd, short args, void *cbdata)
             goto cleanup;
         }
         nptr->nspace = strdup(cd->proc.nspace);
-        pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+        pmix_nspace_add(nptr);
     }
     /* setup a peer object for this client - since the host server
      * only deals with the original processes and not any clones,
@@ -1865,13 +1876,9 @@ static void _register_client(int sd, short args, void *cbdata)
                  * if the nspaces are all completely registered */
                 if (all_def) {
                     /* so far, they have all been defined - check this one */
-                    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-                        if (0 == strcmp(trk->pcs[i].nspace, ns->nspace)) {
-                            if (SIZE_MAX == ns->nlocalprocs || !ns->all_registered) {
-                                all_def = false;
-                            }
-                            break;
-                        }
+                    ns = pmix_nspace_lookup(trk->pcs[i].nspace);
+                    if (NULL != ns && (SIZE_MAX == ns->nlocalprocs || !ns->all_registered)) {
+                        all_def = false;
                     }
                 }
                 /* now see if this nspace is the one to which the client we just
@@ -1973,7 +1980,7 @@ static void _deregister_client(int sd, short args, void *cbdata)
 {
     pmix_setup_caddy_t *cd = (pmix_setup_caddy_t *) cbdata;
     pmix_rank_info_t *info;
-    pmix_namespace_t *nptr, *tmp;
+    pmix_namespace_t *nptr;
     pmix_peer_t *peer;
 
     PMIX_ACQUIRE_OBJECT(cd);
@@ -1984,13 +1991,7 @@ static void _deregister_client(int sd, short args, void *cbdata)
                         cd->proc.rank);
 
     /* see if we already have this nspace */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(tmp->nspace, cd->proc.nspace)) {
-            nptr = tmp;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(cd->proc.nspace);
     if (NULL == nptr) {
         /* nothing to do */
         goto cleanup;
@@ -2133,6 +2134,11 @@ PMIX_EXPORT pmix_status_t PMIx_server_setup_fork(const pmix_proc_t *proc, char *
 
     /* pass our active security modules */
     pmix_setenv("PMIX_SECURITY_MODE", security_mode, true, env);
+    /* pass our available bfrops modules so the client can
+     * pick the best one we have in common */
+    if (NULL != bfrops_mode) {
+        pmix_setenv("PMIX_BFROPS_MODE", bfrops_mode, true, env);
+    }
     /* pass the type of buffer we are using */
     if (PMIX_BFROP_BUFFER_FULLY_DESC == pmix_globals.mypeer->nptr->compat.type) {
         pmix_setenv("PMIX_BFROP_BUFFER_TYPE", "PMIX_BFROP_BUFFER_FULLY_DESC", true, env);
@@ -2192,7 +2198,7 @@ static void _dmodex_req(int sd, short args, void *cbdata)
 {
     pmix_setup_caddy_t *cd = (pmix_setup_caddy_t *) cbdata;
     pmix_rank_info_t *info, *iptr;
-    pmix_namespace_t *nptr, *ns;
+    pmix_namespace_t *nptr;
     char *data = NULL;
     size_t sz = 0;
     pmix_dmdx_remote_t *dcd;
@@ -2211,13 +2217,7 @@ static void _dmodex_req(int sd, short args, void *cbdata)
      * could cause this request to arrive prior to us having
      * been informed of it - so first check to see if we know
      * about this nspace yet */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(ns->nspace, cd->proc.nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(cd->proc.nspace);
     if (NULL == nptr) {
         /* we don't know this namespace yet, and so we obviously
          * haven't received the data from this proc yet - defer
@@ -2228,7 +2228,7 @@ static void _dmodex_req(int sd, short args, void *cbdata)
             goto cleanup;
         }
         dcd->cd = cd;
-        pmix_list_append(&pmix_server_globals.remote_pnd, &dcd->super);
+        pmix_dmdx_remote_add(dcd);
         return;
     }
 
@@ -2273,7 +2273,7 @@ static void _dmodex_req(int sd, short args, void *cbdata)
          * the request until we do */
         dcd = PMIX_NEW(pmix_dmdx_remote_t);
         dcd->cd = cd;
-        pmix_list_append(&pmix_server_globals.remote_pnd, &dcd->super);
+        pmix_dmdx_remote_add(dcd);
         return;
     }
 
@@ -2284,7 +2284,7 @@ static void _dmodex_req(int sd, short args, void *cbdata)
          * data is recvd */
         dcd = PMIX_NEW(pmix_dmdx_remote_t);
         dcd->cd = cd;
-        pmix_list_append(&pmix_server_globals.remote_pnd, &dcd->super);
+        pmix_dmdx_remote_add(dcd);
         return;
     }
 
@@ -3289,6 +3289,7 @@ static void _mdxcbfunc(int sd, short args, void *cbdata)
     pmix_status_t rc = PMIX_SUCCESS, ret;
     pmix_nspace_caddy_t *nptr;
     pmix_list_t nslist;
+    pmix_bfrops_module_t *bfrops;
     bool found;
 
     PMIX_ACQUIRE_OBJECT(scd);
@@ -3353,8 +3354,9 @@ static void _mdxcbfunc(int sd, short args, void *cbdata)
         }
     }
     PMIX_LIST_FOREACH (nptr, &nslist, pmix_nspace_caddy_t) {
-        /* pass the blobs being returned */
-        PMIX_LOAD_BUFFER(pmix_globals.mypeer, &xfer, scd->data, scd->ndata);
+        /* pass the blobs being returned - each GDS module
+         * reads the same bytes, so don't hand over ownership */
+        PMIX_LOAD_BUFFER_NON_DESTRUCT(pmix_globals.mypeer, &xfer, scd->data, scd->ndata);
         PMIX_GDS_STORE_MODEX(rc, nptr->ns, &xfer, tracker);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
@@ -3363,21 +3365,34 @@ static void _mdxcbfunc(int sd, short args, void *cbdata)
     }
 
 finish_collective:
-    /* loop across all procs in the tracker, sending them the reply */
+    /* loop across all procs in the tracker, sending them the reply. The
+     * reply is identical for every participant that uses the same bfrops
+     * module, so pack it only once and queue the same buffer to each of
+     * them - the buffer is refcounted and released by each send */
+    reply = NULL;
+    bfrops = NULL;
     PMIX_LIST_FOREACH_SAFE (cd, nxt, &tracker->local_cbs, pmix_server_caddy_t) {
-        reply = PMIX_NEW(pmix_buffer_t);
-        if (NULL == reply) {
-            break;
-        }
-        /* setup the reply, starting with the returned status */
-        PMIX_BFROPS_PACK(ret, cd->peer, reply, &rc, 1, PMIX_STATUS);
-        if (PMIX_SUCCESS != ret) {
-            PMIX_ERROR_LOG(ret);
-            goto cleanup;
+        if (NULL == reply || bfrops != cd->peer->nptr->compat.bfrops) {
+            if (NULL != reply) {
+                PMIX_RELEASE(reply);
+            }
+            reply = PMIX_NEW(pmix_buffer_t);
+            if (NULL == reply) {
+                break;
+            }
+            bfrops = cd->peer->nptr->compat.bfrops;
+            /* setup the reply, starting with the returned status */
+            PMIX_BFROPS_PACK(ret, cd->peer, reply, &rc, 1, PMIX_STATUS);
+            if (PMIX_SUCCESS != ret) {
+                PMIX_ERROR_LOG(ret);
+                PMIX_RELEASE(reply);
+                goto cleanup;
+            }
         }
         pmix_output_verbose(2, pmix_server_globals.base_output,
                             "server:modex_cbfunc reply being sent to %s:%u",
                             cd->peer->info->pname.nspace, cd->peer->info->pname.rank);
+        PMIX_RETAIN(reply);
         PMIX_SERVER_QUEUE_REPLY(ret, cd->peer, cd->hdr.tag, reply);
         if (PMIX_SUCCESS != ret) {
             PMIX_RELEASE(reply);
@@ -3386,6 +3401,9 @@ finish_collective:
         pmix_list_remove_item(&tracker->local_cbs, &cd->super);
         PMIX_RELEASE(cd);
     }
+    if (NULL != reply) {
+        PMIX_RELEASE(reply);
+    }
 
 cleanup:
     /* Protect data from being free'd because RM pass
@@ -3397,7 +3415,7 @@ cleanup:
     xfer.bytes_used = 0;
     PMIX_DESTRUCT(&xfer);
 
-    pmix_list_remove_item(&pmix_server_globals.collectives, &tracker->super);
+    pmix_server_trk_remove(tracker);
     PMIX_RELEASE(tracker);
     PMIX_LIST_DESTRUCT(&nslist);
 
@@ -3470,13 +3488,26 @@ static void get_cbfunc(pmix_status_t status, const char *data, size_t ndata, voi
         PMIX_ERROR_LOG(rc);
         goto cleanup;
     }
-    /* pack the blob being returned */
-    PMIX_CONSTRUCT(&buf, pmix_buffer_t);
-    PMIX_LOAD_BUFFER(cd->peer, &buf, data, ndata);
-    PMIX_BFROPS_COPY_PAYLOAD(rc, cd->peer, reply, &buf);
-    buf.base_ptr = NULL;
-    buf.bytes_used = 0;
-    PMIX_DESTRUCT(&buf);
+    if (NULL != relfn) {
+        /* we were given the blob to keep, so send it from where
+         * it sits rather than copying it into the reply - the
+         * reply now takes care of releasing it */
+        PMIX_BFROPS_ATTACH(rc, reply, (char *) data, ndata, relfn, relcbd);
+        relfn = NULL;
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_RELEASE(reply);
+            goto cleanup;
+        }
+    } else {
+        /* pack the blob being returned */
+        PMIX_CONSTRUCT(&buf, pmix_buffer_t);
+        PMIX_LOAD_BUFFER(cd->peer, &buf, data, ndata);
+        PMIX_BFROPS_COPY_PAYLOAD(rc, cd->peer, reply, &buf);
+        buf.base_ptr = NULL;
+        buf.bytes_used = 0;
+        PMIX_DESTRUCT(&buf);
+    }
     /* send the data to the requestor */
     pmix_output_verbose(2, pmix_server_globals.base_output,
                         "server:get_cbfunc reply being sent to %s:%u", cd->peer->info->pname.nspace,
@@ -3672,7 +3703,7 @@ cleanup:
     if (NULL != nspaces) {
         pmix_argv_free(nspaces);
     }
-    pmix_list_remove_item(&pmix_server_globals.collectives, &tracker->super);
+    pmix_server_trk_remove(tracker);
     PMIX_RELEASE(tracker);
 
     /* we are done */
@@ -3750,7 +3781,7 @@ static void _discnct(int sd, short args, void *cbdata)
 cleanup:
     /* cleanup the tracker -- the host RM is responsible for
      * telling us when to remove the nspace from our data */
-    pmix_list_remove_item(&pmix_server_globals.collectives, &tracker->super);
+    pmix_server_trk_remove(tracker);
     PMIX_RELEASE(tracker);
 
     /* we are done */
@@ -91,6 +91,7 @@ static pmix_status_t create_local_tracker(char nspace[], pmix_rank_t rank, pmix_
                                           pmix_dmdx_local_t **lcd, pmix_dmdx_request_t **rq);
 static pmix_status_t get_job_data(char *nspace, pmix_server_caddy_t *cd, pmix_buffer_t *pbkt);
 static void get_timeout(int sd, short args, void *cbdata);
+static void _process_dmdx_reply(int sd, short args, void *cbdata);
 
 /* declare a function whose sole purpose is to
  * free data that we provided to our host server
@@ -103,6 +104,674 @@ static void relfn(void *cbdata)
     }
 }
 
+/* pending dmodex requests are indexed by the (nspace, rank) of the
+ * proc whose data is wanted so that a commit or a reply from the
+ * host can find its waiters without scanning every request */
+#define PMIX_DMDX_KEY_MAX (PMIX_MAX_NSLEN + sizeof(pmix_rank_t))
+
+static size_t dmdx_key(const char *nspace, pmix_rank_t rank, char *key)
+{
+    size_t len = pmix_nslen(nspace);
+
+    memcpy(key, nspace, len);
+    memcpy(key + len, &rank, sizeof(pmix_rank_t));
+    return len + sizeof(pmix_rank_t);
+}
+
+pmix_dmdx_local_t *pmix_dmdx_local_find(const char *nspace, pmix_rank_t rank)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+    pmix_dmdx_local_t *lcd = NULL;
+
+    len = dmdx_key(nspace, rank, key);
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_ptr(&pmix_server_globals.local_reqs_index,
+                                                      key, len, (void **) &lcd)) {
+        return NULL;
+    }
+    return lcd;
+}
+
+void pmix_dmdx_local_add(pmix_dmdx_local_t *lcd)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+
+    pmix_list_append(&pmix_server_globals.local_reqs, &lcd->super);
+    len = dmdx_key(lcd->proc.nspace, lcd->proc.rank, key);
+    pmix_hash_table_set_value_ptr(&pmix_server_globals.local_reqs_index, key, len, lcd);
+}
+
+void pmix_dmdx_local_remove(pmix_dmdx_local_t *lcd)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+
+    if (lcd == pmix_dmdx_local_find(lcd->proc.nspace, lcd->proc.rank)) {
+        len = dmdx_key(lcd->proc.nspace, lcd->proc.rank, key);
+        pmix_hash_table_remove_value_ptr(&pmix_server_globals.local_reqs_index, key, len);
+    }
+    pmix_list_remove_item(&pmix_server_globals.local_reqs, &lcd->super);
+}
+
+void pmix_dmdx_remote_add(pmix_dmdx_remote_t *dcd)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+    pmix_list_t *pnd = NULL;
+
+    len = dmdx_key(dcd->cd->proc.nspace, dcd->cd->proc.rank, key);
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_ptr(&pmix_server_globals.remote_pnd, key, len,
+                                                      (void **) &pnd)) {
+        pnd = PMIX_NEW(pmix_list_t);
+        pmix_hash_table_set_value_ptr(&pmix_server_globals.remote_pnd, key, len, pnd);
+    }
+    pmix_list_append(pnd, &dcd->super);
+}
+
+pmix_list_t *pmix_dmdx_remote_take(const char *nspace, pmix_rank_t rank)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+    pmix_list_t *pnd = NULL;
+
+    len = dmdx_key(nspace, rank, key);
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_ptr(&pmix_server_globals.remote_pnd, key, len,
+                                                      (void **) &pnd)) {
+        return NULL;
+    }
+    pmix_hash_table_remove_value_ptr(&pmix_server_globals.remote_pnd, key, len);
+    return pnd;
+}
+
+void pmix_dmdx_remote_purge(void)
+{
+    void *key;
+    pmix_list_t *pnd;
+
+    PMIX_HASH_TABLE_FOREACH_PTR(key, pnd, &pmix_server_globals.remote_pnd, {
+        PMIX_LIST_RELEASE(pnd);
+    });
+    pmix_hash_table_remove_all(&pmix_server_globals.remote_pnd);
+}
+
+/* when batching is enabled, dmodex requests for remote procs are held
+ * for a short window and those whose targets share a host are passed
+ * up to our host in a single request via PMIX_DMODEX_PROCS */
+typedef struct {
+    pmix_list_item_t super;
+    char *hostname;
+    pmix_pointer_array_t lcds;
+    int nlcds;
+} pmix_dmdx_batch_t;
+static void bcon(pmix_dmdx_batch_t *p)
+{
+    p->hostname = NULL;
+    PMIX_CONSTRUCT(&p->lcds, pmix_pointer_array_t);
+    pmix_pointer_array_init(&p->lcds, 8, INT_MAX, 8);
+    p->nlcds = 0;
+}
+static void bdes(pmix_dmdx_batch_t *p)
+{
+    int n;
+    pmix_dmdx_local_t *lcd;
+
+    if (NULL != p->hostname) {
+        free(p->hostname);
+    }
+    for (n = 0; n < p->nlcds; n++) {
+        lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&p->lcds, n);
+        if (NULL != lcd) {
+            PMIX_RELEASE(lcd);
+        }
+    }
+    PMIX_DESTRUCT(&p->lcds);
+}
+static PMIX_CLASS_INSTANCE(pmix_dmdx_batch_t, pmix_list_item_t, bcon, bdes);
+
+typedef struct {
+    pmix_object_t super;
+    pmix_event_t ev;
+    pmix_status_t status;
+    const char *data;
+    size_t ndata;
+    pmix_dmdx_batch_t *batch;
+    pmix_release_cbfunc_t relcbfunc;
+    void *cbdata;
+} pmix_dmdx_batch_reply_t;
+static PMIX_CLASS_INSTANCE(pmix_dmdx_batch_reply_t, pmix_object_t, NULL, NULL);
+
+static pmix_event_t dmdx_batch_ev;
+static bool dmdx_batch_timer_active = false;
+static int dmdx_batch_count = 0;
+
+static void dmdx_batch_flush(int sd, short args, void *cbdata);
+
+static char *dmdx_hostname(pmix_proc_t *proc)
+{
+    pmix_cb_t cb;
+    pmix_info_t optional;
+    pmix_kval_t *kv;
+    pmix_status_t rc;
+    char *hostname = NULL;
+
+    PMIX_CONSTRUCT(&cb, pmix_cb_t);
+    PMIX_INFO_LOAD(&optional, PMIX_OPTIONAL, NULL, PMIX_BOOL);
+    cb.proc = proc;
+    cb.key = PMIX_HOSTNAME;
+    cb.info = &optional;
+    cb.ninfo = 1;
+    PMIX_GDS_FETCH_KV(rc, pmix_globals.mypeer, &cb);
+    if (PMIX_SUCCESS == rc) {
+        kv = (pmix_kval_t *) pmix_list_get_first(&cb.kvs);
+        if (NULL != kv && NULL != kv->value && PMIX_STRING == kv->value->type
+            && NULL != kv->value->data.string) {
+            hostname = strdup(kv->value->data.string);
+        }
+    }
+    cb.proc = NULL;
+    cb.key = NULL;
+    cb.info = NULL;
+    cb.ninfo = 0;
+    PMIX_DESTRUCT(&cb);
+    PMIX_INFO_DESTRUCT(&optional);
+    return hostname;
+}
+
+/* hold the given request until the batch window closes - returns
+ * PMIX_ERR_TAKE_NEXT_OPTION if the request cannot be batched and
+ * must be passed up on its own */
+static pmix_status_t dmdx_batch_add(pmix_dmdx_local_t *lcd)
+{
+    pmix_dmdx_batch_t *batch, *bptr;
+    char *hostname;
+    struct timeval tv;
+
+    if (0 >= pmix_server_globals.dmodex_batch_window
+        || PMIX_RANK_VALID < lcd->proc.rank) {
+        return PMIX_ERR_TAKE_NEXT_OPTION;
+    }
+    hostname = dmdx_hostname(&lcd->proc);
+    if (NULL == hostname) {
+        return PMIX_ERR_TAKE_NEXT_OPTION;
+    }
+    batch = NULL;
+    PMIX_LIST_FOREACH (bptr, &pmix_server_globals.dmdx_batches, pmix_dmdx_batch_t) {
+        if (0 == strcmp(bptr->hostname, hostname)) {
+            batch = bptr;
+            break;
+        }
+    }
+    if (NULL == batch) {
+        batch = PMIX_NEW(pmix_dmdx_batch_t);
+        batch->hostname = hostname;
+        pmix_list_append(&pmix_server_globals.dmdx_batches, &batch->super);
+    } else {
+        free(hostname);
+    }
+    /* the request may be resolved by other means (e.g., the host
+     * registering the nspace) while we hold it, so keep it alive */
+    PMIX_RETAIN(lcd);
+    pmix_pointer_array_set_item(&batch->lcds, batch->nlcds, lcd);
+    batch->nlcds++;
+    dmdx_batch_count++;
+
+    pmix_output_verbose(2, pmix_server_globals.get_output,
+                        "%s batching dmodex request for %s on host %s",
+                        PMIX_NAME_PRINT(&pmix_globals.myid),
+                        PMIX_NAME_PRINT(&lcd->proc), batch->hostname);
+
+    /* the flush always runs from the event loop as our caller
+     * may be walking the list of pending requests */
+    if (dmdx_batch_count >= pmix_server_globals.dmodex_batch_max) {
+        if (dmdx_batch_timer_active) {
+            pmix_event_evtimer_del(&dmdx_batch_ev);
+        }
+        tv.tv_sec = 0;
+        tv.tv_usec = 0;
+    } else if (!dmdx_batch_timer_active) {
+        tv.tv_sec = pmix_server_globals.dmodex_batch_window / 1000000;
+        tv.tv_usec = pmix_server_globals.dmodex_batch_window % 1000000;
+    } else {
+        return PMIX_SUCCESS;
+    }
+    pmix_event_evtimer_set(pmix_globals.evbase, &dmdx_batch_ev, dmdx_batch_flush, NULL);
+    pmix_event_evtimer_add(&dmdx_batch_ev, &tv);
+    dmdx_batch_timer_active = true;
+    return PMIX_SUCCESS;
+}
+
+/* hand the result for a held request to everyone waiting on it
+ * and drop the reference the batch kept on it */
+static void dmdx_batch_deliver(pmix_dmdx_local_t *lcd, pmix_status_t status,
+                               const char *data, size_t ndata)
+{
+    pmix_dmdx_reply_caddy_t *caddy;
+
+    if (lcd == pmix_dmdx_local_find(lcd->proc.nspace, lcd->proc.rank)) {
+        caddy = PMIX_NEW(pmix_dmdx_reply_caddy_t);
+        caddy->status = status;
+        caddy->data = data;
+        caddy->ndata = ndata;
+        caddy->lcd = lcd;
+        _process_dmdx_reply(0, 0, caddy);
+    }
+    PMIX_RELEASE(lcd);
+}
+
+static void dmdx_batch_release(pmix_dmdx_batch_t *batch);
+
+static void _process_dmdx_batch_reply(int sd, short args, void *cbdata)
+{
+    pmix_dmdx_batch_reply_t *reply = (pmix_dmdx_batch_reply_t *) cbdata;
+    pmix_dmdx_batch_t *batch = reply->batch;
+    pmix_dmdx_local_t *lcd;
+    pmix_buffer_t pbkt;
+    pmix_proc_t proc;
+    pmix_status_t rc, status;
+    pmix_byte_object_t bo;
+    int32_t cnt;
+    int n;
+
+    PMIX_ACQUIRE_OBJECT(reply);
+    PMIX_HIDE_UNUSED_PARAMS(sd, args);
+
+    pmix_output_verbose(2, pmix_server_globals.get_output,
+                        "[%s:%d] process batched dmdx reply for %d procs on host %s",
+                        __FILE__, __LINE__, batch->nlcds, batch->hostname);
+
+    if (PMIX_ERR_NOT_SUPPORTED == reply->status) {
+        /* the host does not understand batched requests - ask
+         * for each proc on its own instead */
+        if (NULL != reply->relcbfunc) {
+            reply->relcbfunc(reply->cbdata);
+        }
+        dmdx_batch_release(batch);
+        PMIX_RELEASE(reply);
+        return;
+    }
+
+    if (PMIX_SUCCESS == reply->status && NULL != reply->data) {
+        PMIX_CONSTRUCT(&pbkt, pmix_buffer_t);
+        PMIX_LOAD_BUFFER(pmix_globals.mypeer, &pbkt, reply->data, reply->ndata);
+        cnt = 1;
+        PMIX_BFROPS_UNPACK(rc, pmix_globals.mypeer, &pbkt, &proc, &cnt, PMIX_PROC);
+        while (PMIX_SUCCESS == rc) {
+            cnt = 1;
+            PMIX_BFROPS_UNPACK(rc, pmix_globals.mypeer, &pbkt, &status, &cnt, PMIX_STATUS);
+            if (PMIX_SUCCESS != rc) {
+                break;
+            }
+            cnt = 1;
+            PMIX_BFROPS_UNPACK(rc, pmix_globals.mypeer, &pbkt, &bo, &cnt, PMIX_BYTE_OBJECT);
+            if (PMIX_SUCCESS != rc) {
+                break;
+            }
+            for (n = 0; n < batch->nlcds; n++) {
+                lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, n);
+                if (NULL != lcd && PMIX_CHECK_PROCID(&lcd->proc, &proc)) {
+                    pmix_pointer_array_set_item(&batch->lcds, n, NULL);
+                    dmdx_batch_deliver(lcd, status, bo.bytes, bo.size);
+                    break;
+                }
+            }
+            PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+            cnt = 1;
+            PMIX_BFROPS_UNPACK(rc, pmix_globals.mypeer, &pbkt, &proc, &cnt, PMIX_PROC);
+        }
+        pbkt.base_ptr = NULL; // protect the data
+        PMIX_DESTRUCT(&pbkt);
+        if (PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != rc) {
+            PMIX_ERROR_LOG(rc);
+        }
+        status = PMIX_ERR_NOT_FOUND;
+    } else {
+        status = reply->status;
+    }
+
+    /* anything the host didn't return cannot be found */
+    for (n = 0; n < batch->nlcds; n++) {
+        lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, n);
+        if (NULL != lcd) {
+            pmix_pointer_array_set_item(&batch->lcds, n, NULL);
+            dmdx_batch_deliver(lcd, status, NULL, 0);
+        }
+    }
+
+    if (NULL != reply->relcbfunc) {
+        reply->relcbfunc(reply->cbdata);
+    }
+    PMIX_RELEASE(batch);
+    PMIX_RELEASE(reply);
+}
+
+static void dmdx_batch_cbfunc(pmix_status_t status, const char *data, size_t ndata, void *cbdata,
+                              pmix_release_cbfunc_t release_fn, void *release_cbdata)
+{
+    pmix_dmdx_batch_reply_t *reply;
+
+    /* the host may call us from their own thread */
+    reply = PMIX_NEW(pmix_dmdx_batch_reply_t);
+    reply->status = status;
+    reply->data = data;
+    reply->ndata = ndata;
+    reply->batch = (pmix_dmdx_batch_t *) cbdata;
+    reply->relcbfunc = release_fn;
+    reply->cbdata = release_cbdata;
+    PMIX_THREADSHIFT(reply, _process_dmdx_batch_reply);
+}
+
+/* pass each request in the batch that is still pending up to
+ * our host on its own */
+static void dmdx_batch_release(pmix_dmdx_batch_t *batch)
+{
+    pmix_dmdx_local_t *lcd;
+    pmix_status_t rc;
+    int n;
+
+    for (n = 0; n < batch->nlcds; n++) {
+        lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, n);
+        if (NULL == lcd) {
+            continue;
+        }
+        pmix_pointer_array_set_item(&batch->lcds, n, NULL);
+        /* the host may have refused the batch after we sent it, and
+         * the request may have been satisfied or removed since then,
+         * so only ask again for one that is still on the pending list */
+        if (lcd != pmix_dmdx_local_find(lcd->proc.nspace, lcd->proc.rank)) {
+            PMIX_RELEASE(lcd);
+            continue;
+        }
+        rc = pmix_host_server.direct_modex(&lcd->proc, lcd->info, lcd->ninfo,
+                                           dmdx_cbfunc, lcd);
+        if (PMIX_SUCCESS != rc) {
+            dmdx_batch_deliver(lcd, PMIX_ERR_NOT_FOUND, NULL, 0);
+        } else {
+            PMIX_RELEASE(lcd);
+        }
+    }
+    PMIX_RELEASE(batch);
+}
+
+/* pass each held request up to our host - requests whose
+ * targets share a host go up together */
+static void dmdx_batch_flush(int sd, short args, void *cbdata)
+{
+    pmix_dmdx_batch_t *batch;
+    pmix_dmdx_local_t *lcd;
+    pmix_data_array_t darray;
+    pmix_proc_t *procs;
+    pmix_info_t info;
+    pmix_status_t rc;
+    int n, m;
+    PMIX_HIDE_UNUSED_PARAMS(sd, args, cbdata);
+
+    dmdx_batch_timer_active = false;
+    dmdx_batch_count = 0;
+
+    while (NULL != (batch = (pmix_dmdx_batch_t *) pmix_list_remove_first(
+                        &pmix_server_globals.dmdx_batches))) {
+        /* drop anything that was resolved while we held it */
+        m = 0;
+        for (n = 0; n < batch->nlcds; n++) {
+            lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, n);
+            pmix_pointer_array_set_item(&batch->lcds, n, NULL);
+            if (lcd != pmix_dmdx_local_find(lcd->proc.nspace, lcd->proc.rank)) {
+                PMIX_RELEASE(lcd);
+                continue;
+            }
+            pmix_pointer_array_set_item(&batch->lcds, m, lcd);
+            ++m;
+        }
+        batch->nlcds = m;
+
+        if (0 == batch->nlcds) {
+            PMIX_RELEASE(batch);
+            continue;
+        } else if (1 == batch->nlcds) {
+            /* nothing to gain - send it up on its own */
+            dmdx_batch_release(batch);
+            continue;
+        }
+
+        PMIX_PROC_CREATE(procs, batch->nlcds);
+        for (n = 0; n < batch->nlcds; n++) {
+            lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, n);
+            if (NULL != lcd) {
+                PMIX_XFER_PROCID(&procs[n], &lcd->proc);
+            }
+        }
+        darray.type = PMIX_PROC;
+        darray.array = procs;
+        darray.size = batch->nlcds;
+        PMIX_INFO_LOAD(&info, PMIX_DMODEX_PROCS, &darray, PMIX_DATA_ARRAY);
+        /* a host that ignored this would return just the first proc's
+         * blob, so make it refuse the request instead */
+        PMIX_INFO_REQUIRED(&info);
+        PMIX_PROC_FREE(procs, batch->nlcds);
+
+        pmix_output_verbose(2, pmix_server_globals.get_output,
+                            "%s passing up dmodex request for %d procs on host %s",
+                            PMIX_NAME_PRINT(&pmix_globals.myid), batch->nlcds, batch->hostname);
+
+        lcd = (pmix_dmdx_local_t *) pmix_pointer_array_get_item(&batch->lcds, 0);
+        rc = pmix_host_server.direct_modex(&lcd->proc, &info, 1, dmdx_batch_cbfunc, batch);
+        PMIX_INFO_DESTRUCT(&info);
+        if (PMIX_SUCCESS != rc) {
+            /* the host may not understand batched requests */
+            dmdx_batch_release(batch);
+        }
+    }
+}
+
+void pmix_dmdx_batch_purge(void)
+{
+    if (dmdx_batch_timer_active) {
+        pmix_event_evtimer_del(&dmdx_batch_ev);
+        dmdx_batch_timer_active = false;
+    }
+    dmdx_batch_count = 0;
+    PMIX_LIST_DESTRUCT(&pmix_server_globals.dmdx_batches);
+}
+
+/* when prefetching is enabled, we watch the ranks of the direct
+ * modex requests we pass up (or satisfy from prefetched data) for
+ * each nspace. Once enough of them in a row share a stride, we ask
+ * the host for the next few ranks along that stride before anyone
+ * wants them so the requests can be satisfied from our own store */
+typedef struct {
+    pmix_list_item_t super;
+    pmix_nspace_t nspace;
+    pmix_rank_t last;  // last rank requested
+    int64_t stride;    // distance between the last two requests
+    int streak;        // number of consecutive requests at this stride
+    int64_t next;      // next rank along the stride not yet requested
+} pmix_dmdx_stream_t;
+static void scon(pmix_dmdx_stream_t *p)
+{
+    p->last = PMIX_RANK_INVALID;
+    p->stride = 0;
+    p->streak = 0;
+    p->next = -1;
+}
+static PMIX_CLASS_INSTANCE(pmix_dmdx_stream_t, pmix_list_item_t, scon, NULL);
+
+/* returns true if we prefetched the data for this proc, and
+ * forgets that we did so each prefetch is only credited once */
+static bool dmdx_prefetch_hit(const char *nspace, pmix_rank_t rank)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+    void *ptr;
+
+    if (0 >= pmix_server_globals.dmodex_prefetch_depth) {
+        return false;
+    }
+    len = dmdx_key(nspace, rank, key);
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_ptr(&pmix_server_globals.prefetched,
+                                                      key, len, &ptr)) {
+        return false;
+    }
+    pmix_hash_table_remove_value_ptr(&pmix_server_globals.prefetched, key, len);
+    return true;
+}
+
+static void dmdx_prefetch(pmix_namespace_t *nptr, pmix_dmdx_stream_t *st, pmix_rank_t rank)
+{
+    char key[PMIX_DMDX_KEY_MAX];
+    size_t len;
+    void *ptr;
+    pmix_rank_info_t *iptr;
+    pmix_dmdx_local_t *lcd;
+    pmix_status_t rc;
+
+    /* skip our own procs - they will give us their data */
+    PMIX_LIST_FOREACH (iptr, &nptr->ranks, pmix_rank_info_t) {
+        if (rank == iptr->pname.rank) {
+            return;
+        }
+    }
+    /* skip anything already requested */
+    if (NULL != pmix_dmdx_local_find(nptr->nspace, rank)) {
+        return;
+    }
+    len = dmdx_key(nptr->nspace, rank, key);
+    if (PMIX_SUCCESS == pmix_hash_table_get_value_ptr(&pmix_server_globals.prefetched,
+                                                      key, len, &ptr)) {
+        return;
+    }
+
+    pmix_output_verbose(2, pmix_server_globals.get_output,
+                        "%s prefetching dmodex data for %s:%u",
+                        PMIX_NAME_PRINT(&pmix_globals.myid), nptr->nspace, rank);
+
+    /* track it like any other request so that real requests
+     * arriving while it is outstanding simply join it */
+    lcd = PMIX_NEW(pmix_dmdx_local_t);
+    PMIX_LOAD_PROCID(&lcd->proc, nptr->nspace, rank);
+    pmix_dmdx_local_add(lcd);
+    pmix_hash_table_set_value_ptr(&pmix_server_globals.prefetched, key, len, st);
+    if (PMIX_SUCCESS == dmdx_batch_add(lcd)) {
+        return;
+    }
+    rc = pmix_host_server.direct_modex(&lcd->proc, NULL, 0, dmdx_cbfunc, lcd);
+    if (PMIX_SUCCESS != rc) {
+        pmix_hash_table_remove_value_ptr(&pmix_server_globals.prefetched, key, len);
+        pmix_dmdx_local_remove(lcd);
+        PMIX_RELEASE(lcd);
+    }
+}
+
+/* record a request for remote data and prefetch
+ * ahead of it if it continues a pattern */
+static void dmdx_prefetch_observe(pmix_namespace_t *nptr, pmix_rank_t rank)
+{
+    pmix_dmdx_stream_t *st, *sptr;
+    int64_t stride, r;
+
+    if (0 >= pmix_server_globals.dmodex_prefetch_depth || NULL == nptr
+        || !nptr->all_registered || 0 == nptr->nprocs || PMIX_RANK_VALID < rank
+        || NULL == pmix_host_server.direct_modex) {
+        return;
+    }
+
+    st = NULL;
+    PMIX_LIST_FOREACH (sptr, &pmix_server_globals.dmdx_streams, pmix_dmdx_stream_t) {
+        if (PMIX_CHECK_NSPACE(sptr->nspace, nptr->nspace)) {
+            st = sptr;
+            break;
+        }
+    }
+    if (NULL == st) {
+        st = PMIX_NEW(pmix_dmdx_stream_t);
+        PMIX_LOAD_NSPACE(st->nspace, nptr->nspace);
+        pmix_list_append(&pmix_server_globals.dmdx_streams, &st->super);
+    }
+
+    if (PMIX_RANK_INVALID == st->last) {
+        st->streak = 1;
+    } else {
+        stride = (int64_t) rank - (int64_t) st->last;
+        if (0 != stride && stride == st->stride) {
+            ++st->streak;
+        } else {
+            st->stride = stride;
+            st->streak = 2;
+            st->next = -1;
+        }
+    }
+    st->last = rank;
+
+    if (st->streak < pmix_server_globals.dmodex_prefetch_window || 0 == st->stride) {
+        return;
+    }
+
+    /* keep depth ranks requested ahead of this one */
+    r = (int64_t) rank + st->stride;
+    if (0 <= st->next && (st->next - r) / st->stride > 0) {
+        r = st->next;
+    }
+    while ((r - (int64_t) rank) / st->stride <= pmix_server_globals.dmodex_prefetch_depth) {
+        if (r < 0 || r >= (int64_t) nptr->nprocs) {
+            break;
+        }
+        dmdx_prefetch(nptr, st, (pmix_rank_t) r);
+        r += st->stride;
+    }
+    st->next = r;
+}
+
+void pmix_dmdx_prefetch_purge(void)
+{
+    PMIX_LIST_DESTRUCT(&pmix_server_globals.dmdx_streams);
+    pmix_hash_table_remove_all(&pmix_server_globals.prefetched);
+}
+
+void pmix_dmdx_prefetch_purge_nspace(const char *nspace)
+{
+    pmix_dmdx_stream_t *st, *stnext;
+    pmix_rank_t *ranks = NULL, *tmp;
+    size_t nranks = 0, maxranks = 0, keylen, len, n;
+    char key[PMIX_DMDX_KEY_MAX];
+    void *kptr, *ptr, *node;
+    int rc;
+
+    /* forget the access pattern */
+    PMIX_LIST_FOREACH_SAFE (st, stnext, &pmix_server_globals.dmdx_streams, pmix_dmdx_stream_t) {
+        if (PMIX_CHECK_NSPACE(st->nspace, nspace)) {
+            pmix_list_remove_item(&pmix_server_globals.dmdx_streams, &st->super);
+            PMIX_RELEASE(st);
+        }
+    }
+
+    /* and the procs we prefetched for it - collect their ranks
+     * first as we cannot remove entries while walking the table */
+    len = pmix_nslen(nspace);
+    rc = pmix_hash_table_get_first_key_ptr(&pmix_server_globals.prefetched, &kptr, &keylen,
+                                           &ptr, &node);
+    while (PMIX_SUCCESS == rc) {
+        if (len + sizeof(pmix_rank_t) == keylen && 0 == memcmp(kptr, nspace, len)) {
+            if (nranks == maxranks) {
+                maxranks = (0 == maxranks) ? 16 : 2 * maxranks;
+                tmp = (pmix_rank_t *) realloc(ranks, maxranks * sizeof(pmix_rank_t));
+                if (NULL == tmp) {
+                    break;
+                }
+                ranks = tmp;
+            }
+            memcpy(&ranks[nranks], (char *) kptr + len, sizeof(pmix_rank_t));
+            ++nranks;
+        }
+        rc = pmix_hash_table_get_next_key_ptr(&pmix_server_globals.prefetched, &kptr, &keylen,
+                                              &ptr, node, &node);
+    }
+    for (n = 0; n < nranks; n++) {
+        keylen = dmdx_key(nspace, ranks[n], key);
+        pmix_hash_table_remove_value_ptr(&pmix_server_globals.prefetched, key, keylen);
+    }
+    free(ranks);
+}
+
 static pmix_status_t defer_response(char *nspace, pmix_rank_t rank, pmix_server_caddy_t *cd,
                                     bool localonly, pmix_modex_cbfunc_t cbfunc, void *cbdata,
                                     struct timeval *tv, pmix_dmdx_local_t **locald)
@@ -148,7 +817,7 @@ pmix_status_t pmix_server_get(pmix_buffer_t *buf, pmix_modex_cbfunc_t cbfunc, vo
     pmix_rank_t rank;
     char *cptr, *key = NULL;
     char nspace[PMIX_MAX_NSLEN + 1];
-    pmix_namespace_t *ns, *nptr;
+    pmix_namespace_t *nptr;
     pmix_dmdx_local_t *lcd;
     bool local = false;
     bool localonly = false;
@@ -236,13 +905,7 @@ pmix_status_t pmix_server_get(pmix_buffer_t *buf, pmix_modex_cbfunc_t cbfunc, vo
     }
 
     /* find the nspace object for the target proc */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (0 == strcmp(nspace, ns->nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(nspace);
 
     pmix_output_verbose(2, pmix_server_globals.get_output,
                         "%s EXECUTE GET FOR %s:%d WITH KEY %s ON BEHALF OF %s",
@@ -377,6 +1040,13 @@ pmix_status_t pmix_server_get(pmix_buffer_t *buf, pmix_modex_cbfunc_t cbfunc, vo
         goto request;
     }
 
+    /* if we fetched this ahead of time, credit the prefetch
+     * and see if we should keep going */
+    if (!local && dmdx_prefetch_hit(nspace, rank)) {
+        pmix_server_globals.dmodex_prefetch_hits++;
+        dmdx_prefetch_observe(nptr, rank);
+    }
+
     /* the target nspace is known - if they asked us to wait for a specific
      * key to be available, check if it is present. NOTE: key is only
      * NULL if the request came from an older version */
@@ -518,6 +1188,12 @@ request:
      * resource manager server to please get the info for us from
      * whomever is hosting the target process */
     if (NULL != pmix_host_server.direct_modex) {
+        pmix_server_globals.dmodex_prefetch_misses++;
+        dmdx_prefetch_observe(nptr, rank);
+        /* requests that need a specific key are passed up on their own */
+        if (NULL == key && PMIX_SUCCESS == dmdx_batch_add(lcd)) {
+            return PMIX_SUCCESS;
+        }
         if (NULL != key) {
             sz = cd->ninfo;
             PMIX_INFO_CREATE(info, sz + 1);
@@ -534,14 +1210,14 @@ request:
         rc = pmix_host_server.direct_modex(&lcd->proc, cd->info, cd->ninfo, dmdx_cbfunc, lcd);
         if (PMIX_SUCCESS != rc) {
             /* may have a function entry but not support the request */
-            pmix_list_remove_item(&pmix_server_globals.local_reqs, &lcd->super);
+            pmix_dmdx_local_remove(lcd);
             PMIX_RELEASE(lcd);
         }
     } else {
         pmix_output_verbose(2, pmix_server_globals.get_output, "%s:%d NO SERVER SUPPORT",
                             pmix_globals.myid.nspace, pmix_globals.myid.rank);
         /* if we don't have direct modex feature, just respond with "not found" */
-        pmix_list_remove_item(&pmix_server_globals.local_reqs, &lcd->super);
+        pmix_dmdx_local_remove(lcd);
         PMIX_RELEASE(lcd);
         rc = PMIX_ERR_NOT_FOUND;
     }
@@ -553,7 +1229,7 @@ static pmix_status_t create_local_tracker(char nspace[], pmix_rank_t rank, pmix_
                                           size_t ninfo, pmix_modex_cbfunc_t cbfunc, void *cbdata,
                                           pmix_dmdx_local_t **ld, pmix_dmdx_request_t **rq)
 {
-    pmix_dmdx_local_t *lcd, *cd;
+    pmix_dmdx_local_t *lcd;
     pmix_dmdx_request_t *req;
     pmix_status_t rc;
     size_t n;
@@ -564,14 +1240,7 @@ static pmix_status_t create_local_tracker(char nspace[], pmix_rank_t rank, pmix_
 
     /* see if we already have an existing request for data
      * from this namespace/rank */
-    lcd = NULL;
-    PMIX_LIST_FOREACH (cd, &pmix_server_globals.local_reqs, pmix_dmdx_local_t) {
-        if (!PMIX_CHECK_NSPACE(nspace, cd->proc.nspace) || rank != cd->proc.rank) {
-            continue;
-        }
-        lcd = cd;
-        break;
-    }
+    lcd = pmix_dmdx_local_find(nspace, rank);
     if (NULL != lcd) {
         /* we already have a request, so just track that someone
          * else wants data from the same target */
@@ -593,7 +1262,7 @@ static pmix_status_t create_local_tracker(char nspace[], pmix_rank_t rank, pmix_
             PMIX_INFO_XFER(&lcd->info[n], &info[n]);
         }
     }
-    pmix_list_append(&pmix_server_globals.local_reqs, &lcd->super);
+    pmix_dmdx_local_add(lcd);
     rc = PMIX_ERR_NOT_FOUND; // indicates that we created a new request tracker
 
 complete:
@@ -649,7 +1318,11 @@ void pmix_pending_nspace_requests(pmix_namespace_t *nptr)
         if (!found) {
             rc = PMIX_ERR_NOT_SUPPORTED;
             if (NULL != pmix_host_server.direct_modex) {
-                rc = pmix_host_server.direct_modex(&cd->proc, cd->info, cd->ninfo, dmdx_cbfunc, cd);
+                rc = dmdx_batch_add(cd);
+                if (PMIX_SUCCESS != rc) {
+                    rc = pmix_host_server.direct_modex(&cd->proc, cd->info, cd->ninfo,
+                                                       dmdx_cbfunc, cd);
+                }
             }
             if (PMIX_SUCCESS != rc) {
                 pmix_dmdx_request_t *req, *req_next;
@@ -658,7 +1331,7 @@ void pmix_pending_nspace_requests(pmix_namespace_t *nptr)
                     pmix_list_remove_item(&cd->loc_reqs, &req->super);
                     PMIX_RELEASE(req);
                 }
-                pmix_list_remove_item(&pmix_server_globals.local_reqs, &cd->super);
+                pmix_dmdx_local_remove(cd);
                 PMIX_RELEASE(cd);
             }
         }
@@ -870,21 +1543,15 @@ pmix_status_t pmix_pending_resolve(pmix_namespace_t *nptr,
                                    pmix_scope_t scope,
                                    pmix_dmdx_local_t *lcd)
 {
-    pmix_dmdx_local_t *cd, *ptr;
+    pmix_dmdx_local_t *ptr;
     pmix_dmdx_request_t *req, *rnext;
-    pmix_server_caddy_t scd;
+    pmix_server_caddy_t *scd;
 
     /* find corresponding request (if exists) */
     if (NULL == lcd) {
         ptr = NULL;
         if (NULL != nptr) {
-            PMIX_LIST_FOREACH (cd, &pmix_server_globals.local_reqs, pmix_dmdx_local_t) {
-                if (!PMIX_CHECK_NSPACE(nptr->nspace, cd->proc.nspace) || rank != cd->proc.rank) {
-                    continue;
-                }
-                ptr = cd;
-                break;
-            }
+            ptr = pmix_dmdx_local_find(nptr->nspace, rank);
         }
         if (NULL == ptr) {
             return PMIX_SUCCESS;
@@ -909,27 +1576,25 @@ pmix_status_t pmix_pending_resolve(pmix_namespace_t *nptr,
     } else if (NULL != nptr) {
         /* if we've got the blob - try to satisfy requests */
         /* run through all the requests for this rank */
-        /* this info is going back to one of our peers, so provide a server
-         * caddy with our peer in it so the data gets packed correctly */
-        PMIX_CONSTRUCT(&scd, pmix_server_caddy_t);
-        PMIX_RETAIN(pmix_globals.mypeer);
-        scd.peer = pmix_globals.mypeer;
+        /* this info is going back to the peer that asked for it, which
+         * may not use the same bfrops module we do - so pack it with
+         * the caddy of the original request */
         PMIX_LIST_FOREACH (req, &ptr->loc_reqs, pmix_dmdx_request_t) {
             pmix_status_t rc;
             bool diffnspace = !PMIX_CHECK_NSPACE(nptr->nspace, req->lcd->proc.nspace);
-            rc = _satisfy_request(nptr, rank, &scd, diffnspace, scope,
+            scd = (pmix_server_caddy_t *) req->cbdata;
+            rc = _satisfy_request(nptr, rank, scd, diffnspace, scope,
                                   req->cbfunc, req->cbdata);
             if (PMIX_SUCCESS != rc) {
                 /* if we can't satisfy this particular request (missing key?) */
                 req->cbfunc(rc, NULL, 0, req->cbdata, NULL, NULL);
             }
         }
-        PMIX_DESTRUCT(&scd);
     }
 
 cleanup:
     /* remove all requests to this rank and cleanup the corresponding structure */
-    pmix_list_remove_item(&pmix_server_globals.local_reqs, &ptr->super);
+    pmix_dmdx_local_remove(ptr);
     /* the dmdx request is linked back to its local request for ease
      * of lookup upon return from the server. However, this means that
      * the refcount of the local request has been increased by the number
@@ -954,7 +1619,7 @@ static void _process_dmdx_reply(int sd, short args, void *cbdata)
     pmix_rank_info_t *rinfo, *rptr;
     int32_t cnt;
     pmix_kval_t *kv;
-    pmix_namespace_t *ns, *nptr;
+    pmix_namespace_t *nptr;
     pmix_status_t rc;
     pmix_list_t nspaces;
     pmix_nspace_caddy_t *nm;
@@ -972,13 +1637,7 @@ static void _process_dmdx_reply(int sd, short args, void *cbdata)
                         caddy->lcd->proc.nspace, caddy->lcd->proc.rank);
 
     /* find the nspace object for the proc whose data is being received */
-    nptr = NULL;
-    PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-        if (PMIX_CHECK_NSPACE(caddy->lcd->proc.nspace, ns->nspace)) {
-            nptr = ns;
-            break;
-        }
-    }
+    nptr = pmix_nspace_lookup(caddy->lcd->proc.nspace);
 
     if (NULL == nptr) {
         /* We may not have this namespace because there are no local
@@ -987,7 +1646,7 @@ static void _process_dmdx_reply(int sd, short args, void *cbdata)
         nptr = PMIX_NEW(pmix_namespace_t);
         nptr->nspace = strdup(caddy->lcd->proc.nspace);
         /* add to the list */
-        pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+        pmix_nspace_add(nptr);
     }
 
     /* if the request was successfully satisfied, then store the data.
@@ -1025,6 +1684,14 @@ static void _process_dmdx_reply(int sd, short args, void *cbdata)
                 pmix_list_append(&nspaces, &nm->super);
             }
         }
+        /* nobody has asked for prefetched data yet, so store
+         * it where a request for this proc will find it */
+        if (0 == pmix_list_get_size(&nspaces)) {
+            nm = PMIX_NEW(pmix_nspace_caddy_t);
+            PMIX_RETAIN(nptr);
+            nm->ns = nptr;
+            pmix_list_append(&nspaces, &nm->super);
+        }
         /* now go thru each unique nspace and store the data using its
          * assigned GDS component - note that if the nspace of the requesting
          * proc is different from the nspace of the proc whose data is being
@@ -1120,6 +1787,10 @@ static void _process_dmdx_reply(int sd, short args, void *cbdata)
     }
 
 complete:
+    /* forget failed prefetches so they are not credited as hits */
+    if (PMIX_SUCCESS != caddy->status && 0 == pmix_list_get_size(&caddy->lcd->loc_reqs)) {
+        (void) dmdx_prefetch_hit(caddy->lcd->proc.nspace, caddy->lcd->proc.rank);
+    }
     /* always execute the callback to avoid having the client hang */
     pmix_pending_resolve(nptr, caddy->lcd->proc.rank,
                          caddy->status, PMIX_REMOTE, caddy->lcd);
@@ -24,6 +24,7 @@
 
 #include "include/pmix_server.h"
 #include "src/include/pmix_globals.h"
+#include "src/include/pmix_hash_string.h"
 
 #ifdef HAVE_STRING_H
 #    include <string.h>
@@ -80,11 +81,17 @@ typedef struct {
     pmix_buffer_t *buf;
 } rank_blob_t;
 
+static void bufcon(rank_blob_t *p)
+{
+    p->buf = NULL;
+}
 static void bufdes(rank_blob_t *p)
 {
-    PMIX_RELEASE(p);
+    if (NULL != p->buf) {
+        PMIX_RELEASE(p->buf);
+    }
 }
-static PMIX_CLASS_INSTANCE(rank_blob_t, pmix_list_item_t, NULL, bufdes);
+static PMIX_CLASS_INSTANCE(rank_blob_t, pmix_list_item_t, bufcon, bufdes);
 
 pmix_server_module_t pmix_host_server = {
     .client_connected = NULL,
@@ -200,7 +207,8 @@ pmix_status_t pmix_server_commit(pmix_peer_t *peer, pmix_buffer_t *buf)
     pmix_namespace_t *nptr;
     pmix_rank_info_t *info;
     pmix_proc_t proc;
-    pmix_dmdx_remote_t *dcd, *dcdnext;
+    pmix_dmdx_remote_t *dcd;
+    pmix_list_t *pnd;
     char *data;
     size_t sz;
     pmix_cb_t cb;
@@ -283,12 +291,9 @@ pmix_status_t pmix_server_commit(pmix_peer_t *peer, pmix_buffer_t *buf)
     peer->commit_cnt++;
 
     /* see if anyone remote is waiting on this data - could be more than one */
-    PMIX_LIST_FOREACH_SAFE (dcd, dcdnext, &pmix_server_globals.remote_pnd, pmix_dmdx_remote_t) {
-        if (0 != strncmp(dcd->cd->proc.nspace, nptr->nspace, PMIX_MAX_NSLEN)) {
-            continue;
-        }
-        if (dcd->cd->proc.rank == info->pname.rank) {
-            pmix_list_remove_item(&pmix_server_globals.remote_pnd, &dcd->super);
+    pnd = pmix_dmdx_remote_take(nptr->nspace, info->pname.rank);
+    if (NULL != pnd) {
+        while (NULL != (dcd = (pmix_dmdx_remote_t *) pmix_list_remove_first(pnd))) {
             /* we can now fulfill this request - collect the
              * remote/global data from this proc - note that there
              * may not be a contribution */
@@ -318,6 +323,7 @@ pmix_status_t pmix_server_commit(pmix_peer_t *peer, pmix_buffer_t *buf)
             /* we have finished this request */
             PMIX_RELEASE(dcd);
         }
+        PMIX_RELEASE(pnd);
     }
     /* see if anyone local is waiting on this data- could be more than one */
     rc = pmix_pending_resolve(nptr, info->pname.rank, PMIX_SUCCESS, PMIX_LOCAL, NULL);
@@ -327,6 +333,107 @@ pmix_status_t pmix_server_commit(pmix_peer_t *peer, pmix_buffer_t *buf)
     return rc;
 }
 
+/* compute the signature used to index collective trackers. Trackers
+ * with an operation ID are uniquely identified by that ID. Otherwise,
+ * the collective is identified by the set of participating procs and
+ * the type of operation - the procs may be given in any order, so
+ * combine the per-proc hashes with an order-independent sum */
+static inline uint64_t trk_mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static uint64_t trk_signature(char *id, pmix_proc_t *procs,
+                              size_t nprocs, pmix_cmd_t type)
+{
+    uint32_t h;
+    uint64_t sum = 0;
+    size_t i;
+
+    if (NULL != id) {
+        PMIX_HASH_STR(id, h);
+        return trk_mix(((uint64_t) h << 32) | UINT32_MAX);
+    }
+    for (i = 0; i < nprocs; i++) {
+        PMIX_HASH_STR(procs[i].nspace, h);
+        sum += trk_mix(((uint64_t) h << 32) | procs[i].rank);
+    }
+    return trk_mix(sum ^ ((uint64_t) type << 56) ^ nprocs);
+}
+
+static bool trk_match(pmix_server_trkr_t *trk, char *id, pmix_proc_t *procs,
+                      size_t nprocs, pmix_cmd_t type)
+{
+    size_t i, j;
+    size_t matches;
+
+    if (NULL != id) {
+        return (NULL != trk->id && 0 == strcmp(id, trk->id));
+    }
+    if (nprocs != trk->npcs || type != trk->type) {
+        return false;
+    }
+    /* participants usually pass the procs in the same order,
+     * so check for that first */
+    for (i = 0; i < nprocs; i++) {
+        if (procs[i].rank != trk->pcs[i].rank
+            || !PMIX_CHECK_NSPACE(procs[i].nspace, trk->pcs[i].nspace)) {
+            break;
+        }
+    }
+    if (i == nprocs) {
+        return true;
+    }
+    matches = i;
+    for (; i < nprocs; i++) {
+        /* the procs may be in different order, so we have
+         * to do an exhaustive search */
+        for (j = 0; j < trk->npcs; j++) {
+            if (0 == strcmp(procs[i].nspace, trk->pcs[j].nspace)
+                && procs[i].rank == trk->pcs[j].rank) {
+                ++matches;
+                break;
+            }
+        }
+    }
+    return (trk->npcs == matches);
+}
+
+void pmix_server_trk_remove(pmix_server_trkr_t *trk)
+{
+    pmix_server_trkr_t *head = NULL, *prev;
+
+    pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+
+    /* remove it from the signature index */
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint64(&pmix_server_globals.colltable,
+                                                         trk->sig, (void **) &head)
+        || NULL == head) {
+        return;
+    }
+    if (head == trk) {
+        if (NULL == trk->signext) {
+            pmix_hash_table_remove_value_uint64(&pmix_server_globals.colltable, trk->sig);
+        } else {
+            pmix_hash_table_set_value_uint64(&pmix_server_globals.colltable, trk->sig,
+                                             trk->signext);
+        }
+    } else {
+        for (prev = head; NULL != prev->signext; prev = prev->signext) {
+            if (trk == prev->signext) {
+                prev->signext = trk->signext;
+                break;
+            }
+        }
+    }
+    trk->signext = NULL;
+}
+
 /* get an existing object for tracking LOCAL participation in a collective
  * operation such as "fence". The only way this function can be
  * called is if at least one local client process is participating
@@ -346,9 +453,8 @@ pmix_status_t pmix_server_commit(pmix_peer_t *peer, pmix_buffer_t *buf)
 static pmix_server_trkr_t *get_tracker(char *id, pmix_proc_t *procs,
                                        size_t nprocs, pmix_cmd_t type)
 {
-    pmix_server_trkr_t *trk;
-    size_t i, j;
-    size_t matches;
+    pmix_server_trkr_t *trk = NULL;
+    uint64_t sig;
 
     pmix_output_verbose(5, pmix_server_globals.fence_output,
                         "get_tracker called with %d procs",
@@ -360,43 +466,19 @@ static pmix_server_trkr_t *get_tracker(char *id, pmix_proc_t *procs,
         return NULL;
     }
 
-    /* there is no shortcut way to search the trackers - all
-     * we can do is perform a brute-force search. Fortunately,
-     * it is highly unlikely that there will be more than one
-     * or two active at a time, and they are most likely to
-     * involve only a single proc with WILDCARD rank - so this
-     * shouldn't take long */
-    PMIX_LIST_FOREACH (trk, &pmix_server_globals.collectives, pmix_server_trkr_t) {
-        /* Collective operation if unique identified by
-         * the set of participating processes and the type of collective,
-         * or by the operation ID
-         */
-        if (NULL != id) {
-            if (NULL != trk->id && 0 == strcmp(id, trk->id)) {
-                return trk;
-            }
-        } else {
-            if (nprocs != trk->npcs) {
-                continue;
-            }
-            if (type != trk->type) {
-                continue;
-            }
-            matches = 0;
-            for (i = 0; i < nprocs; i++) {
-                /* the procs may be in different order, so we have
-                 * to do an exhaustive search */
-                for (j = 0; j < trk->npcs; j++) {
-                    if (0 == strcmp(procs[i].nspace, trk->pcs[j].nspace)
-                        && procs[i].rank == trk->pcs[j].rank) {
-                        ++matches;
-                        break;
-                    }
-                }
-            }
-            if (trk->npcs == matches) {
-                return trk;
-            }
+    /* Collective operation if unique identified by
+     * the set of participating processes and the type of collective,
+     * or by the operation ID - lookup the trackers with that
+     * signature and check for an exact match */
+    sig = trk_signature(id, procs, nprocs, type);
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint64(&pmix_server_globals.colltable,
+                                                         sig, (void **) &trk)) {
+        /* No tracker was found */
+        return NULL;
+    }
+    for (; NULL != trk; trk = trk->signext) {
+        if (trk_match(trk, id, procs, nprocs, type)) {
+            return trk;
         }
     }
     /* No tracker was found */
@@ -422,10 +504,10 @@ static pmix_server_trkr_t *get_tracker(char *id, pmix_proc_t *procs,
 static pmix_server_trkr_t *new_tracker(char *id, pmix_proc_t *procs,
                                        size_t nprocs, pmix_cmd_t type)
 {
-    pmix_server_trkr_t *trk;
+    pmix_server_trkr_t *trk, *head = NULL;
     size_t i;
     bool all_def, found;
-    pmix_namespace_t *nptr, *ns;
+    pmix_namespace_t *nptr;
     pmix_rank_info_t *info;
     pmix_nspace_caddy_t *nm;
     pmix_nspace_t first;
@@ -472,13 +554,7 @@ static pmix_server_trkr_t *new_tracker(char *id, pmix_proc_t *procs,
     PMIX_LOAD_NSPACE(first, NULL);
     for (i = 0; i < nprocs; i++) {
         /* is this nspace known to us? */
-        nptr = NULL;
-        PMIX_LIST_FOREACH (ns, &pmix_globals.nspaces, pmix_namespace_t) {
-            if (0 == strcmp(procs[i].nspace, ns->nspace)) {
-                nptr = ns;
-                break;
-            }
-        }
+        nptr = pmix_nspace_lookup(procs[i].nspace);
         /* check if multiple nspaces are involved in this operation */
         if (0 == strlen(first)) {
             PMIX_LOAD_NSPACE(first, procs[i].nspace);
@@ -601,6 +677,15 @@ static pmix_server_trkr_t *new_tracker(char *id, pmix_proc_t *procs,
         trk->def_complete = true;
     }
     pmix_list_append(&pmix_server_globals.collectives, &trk->super);
+
+    /* index it by signature - chain it in front of any
+     * other tracker that happens to share the signature */
+    trk->sig = trk_signature(id, procs, nprocs, type);
+    if (PMIX_SUCCESS == pmix_hash_table_get_value_uint64(&pmix_server_globals.colltable,
+                                                         trk->sig, (void **) &head)) {
+        trk->signext = head;
+    }
+    pmix_hash_table_set_value_uint64(&pmix_server_globals.colltable, trk->sig, trk);
     return trk;
 }
 
@@ -636,6 +721,7 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
     rank_blob_t *blob;
     uint32_t kmap_size;
     int key_idx;
+    size_t bucket_size, blob_size;
 
     /* key names map, the position of the key name
      * in the array determines the unique key index */
@@ -689,18 +775,12 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
                 }
             }
             for (i = 0; i < pmix_argv_count(kmap); i++) {
-                pmix_buffer_t tmp;
                 size_t kname_size;
                 size_t kidx_size;
 
-                PMIX_CONSTRUCT(&tmp, pmix_buffer_t);
-                PMIX_BFROPS_PACK(rc, pmix_globals.mypeer, &tmp, &kmap[i], 1, PMIX_STRING);
-                kname_size = tmp.bytes_used;
-                PMIX_DESTRUCT(&tmp);
-                PMIX_CONSTRUCT(&tmp, pmix_buffer_t);
-                PMIX_BFROPS_PACK(rc, pmix_globals.mypeer, &tmp, &i, 1, PMIX_UINT32);
-                kidx_size = tmp.bytes_used;
-                PMIX_DESTRUCT(&tmp);
+                PMIX_BFROPS_PACK_SIZE(rc, pmix_globals.mypeer, &kmap[i], 1, PMIX_STRING,
+                                      kname_size);
+                PMIX_BFROPS_PACK_SIZE(rc, pmix_globals.mypeer, &i, 1, PMIX_UINT32, kidx_size);
 
                 /* calculate the key names sizes */
                 key_fmt_size[PMIX_MODEX_KEY_NATIVE_FMT] = kname_size * key_count[i];
@@ -741,7 +821,7 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
                 rc = PMIX_ERR_NOT_FOUND;
                 PMIX_ERROR_LOG(rc);
                 PMIX_DESTRUCT(&cb);
-                PMIX_DESTRUCT(&rank_blobs);
+                PMIX_LIST_DESTRUCT(&rank_blobs);
                 PMIX_RELEASE(pbkt);
                 goto cleanup;
             }
@@ -752,7 +832,7 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
             if (PMIX_SUCCESS != rc) {
                 PMIX_ERROR_LOG(rc);
                 PMIX_DESTRUCT(&cb);
-                PMIX_DESTRUCT(&rank_blobs);
+                PMIX_LIST_DESTRUCT(&rank_blobs);
                 PMIX_RELEASE(pbkt);
                 goto cleanup;
             }
@@ -769,7 +849,7 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
                     if (rc != PMIX_SUCCESS) {
                         PMIX_ERROR_LOG(rc);
                         PMIX_DESTRUCT(&cb);
-                        PMIX_DESTRUCT(&rank_blobs);
+                        PMIX_LIST_DESTRUCT(&rank_blobs);
                         PMIX_RELEASE(pbkt);
                         goto cleanup;
                     }
@@ -811,6 +891,20 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
                 PMIX_BFROPS_PACK(rc, pmix_globals.mypeer, &bucket, kmap, kmap_size, PMIX_STRING);
             }
         }
+        /* size the bucket for all the collected blobs at once */
+        bucket_size = 0;
+        PMIX_LIST_FOREACH (blob, &rank_blobs, rank_blob_t) {
+            bo.bytes = blob->buf->unpack_ptr;
+            bo.size = blob->buf->bytes_used;
+            PMIX_BFROPS_PACK_SIZE(rc, pmix_globals.mypeer, &bo, 1, PMIX_BYTE_OBJECT, blob_size);
+            bucket_size += blob_size;
+        }
+        PMIX_BFROPS_RESERVE(rc, &bucket, bucket_size);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_LIST_DESTRUCT(&rank_blobs);
+            goto cleanup;
+        }
         /* pack the collected blobs of processes */
         PMIX_LIST_FOREACH (blob, &rank_blobs, rank_blob_t) {
             /* extract the blob */
@@ -820,10 +914,11 @@ static pmix_status_t _collect_data(pmix_server_trkr_t *trk, pmix_buffer_t *buf)
             PMIX_BYTE_OBJECT_DESTRUCT(&bo); // releases the data
             if (PMIX_SUCCESS != rc) {
                 PMIX_ERROR_LOG(rc);
+                PMIX_LIST_DESTRUCT(&rank_blobs);
                 goto cleanup;
             }
         }
-        PMIX_DESTRUCT(&rank_blobs);
+        PMIX_LIST_DESTRUCT(&rank_blobs);
     } else {
         /* mark the collection type so we can check on the
          * receiving end that all participants did the same.
@@ -1139,7 +1234,11 @@ pmix_status_t pmix_server_fence(pmix_server_caddy_t *cd, pmix_buffer_t *buf,
             trk->modexcbfunc(rc, NULL, 0, trk, NULL, NULL);
             goto cleanup;
         }
-        /* now unload the blob and pass it upstairs */
+        /* now unload the blob and pass it upstairs. The host takes
+         * the data as a single flat array, so unlike a reply to a
+         * client it cannot carry blocks by reference (see
+         * pmix_bfrops_base_attach) - they would only be copied back
+         * in here */
         PMIX_UNLOAD_BUFFER(&bucket, data, sz);
         PMIX_DESTRUCT(&bucket);
         trk->host_called = true;
@@ -2084,11 +2183,10 @@ cleanup:
 static void _check_cached_events(int sd, short args, void *cbdata)
 {
     pmix_setup_caddy_t *scd = (pmix_setup_caddy_t *) cbdata;
-    pmix_notify_caddy_t *cd;
+    pmix_notify_caddy_t *cd, *next;
     pmix_range_trkr_t rngtrk;
     pmix_proc_t proc;
-    int i;
-    size_t k, n;
+    size_t n;
     bool found, matched;
     pmix_buffer_t *relay;
     pmix_status_t ret = PMIX_SUCCESS;
@@ -2099,26 +2197,11 @@ static void _check_cached_events(int sd, short args, void *cbdata)
     /* check if any matching notifications have been cached */
     rngtrk.procs = NULL;
     rngtrk.nprocs = 0;
-    for (i = 0; i < pmix_globals.max_events; i++) {
-        pmix_hotel_knock(&pmix_globals.notifications, i, (void **) &cd);
-        if (NULL == cd) {
-            continue;
-        }
-        found = false;
-        if (NULL == scd->codes) {
-            if (!cd->nondefault) {
-                /* they registered a default event handler - always matches */
-                found = true;
-            }
-        } else {
-            for (k = 0; k < scd->ncodes; k++) {
-                if (scd->codes[k] == cd->status) {
-                    found = true;
-                    break;
-                }
-            }
-        }
-        if (!found) {
+    for (cd = pmix_notify_event_cached_first(scd->codes, scd->ncodes); NULL != cd; cd = next) {
+        next = pmix_notify_event_cached_next(cd, scd->codes, scd->ncodes);
+        /* a default event handler matches anything not
+         * restricted to non-default handlers */
+        if (NULL == scd->codes && cd->nondefault) {
             continue;
         }
         /* check if the affected procs (if given) match those they
@@ -2157,7 +2240,7 @@ static void _check_cached_events(int sd, short args, void *cbdata)
                     /* if this is the last one, then evict this event
                      * from the cache */
                     if (0 == cd->nleft) {
-                        pmix_hotel_checkout(&pmix_globals.notifications, cd->room);
+                        pmix_notify_event_uncache(cd);
                         found = true; // mark that we should release cd
                     }
                     break;
@@ -2252,6 +2335,73 @@ static void regevopcbfunc(pmix_status_t status, void *cbdata)
     PMIX_RELEASE(cd);
 }
 
+/* registered events are indexed by status code so that neither
+ * registration nor notification has to walk every registered code */
+pmix_regevents_info_t *pmix_server_event_reg_find(int code)
+{
+    pmix_regevents_info_t *reginfo = NULL;
+
+    if (0 == pmix_hash_table_get_size(&pmix_server_globals.events_index)) {
+        return NULL;
+    }
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint32(&pmix_server_globals.events_index,
+                                                         (uint32_t) code, (void **) &reginfo)) {
+        return NULL;
+    }
+    return reginfo;
+}
+
+static pmix_regevents_info_t *event_reg_add(int code)
+{
+    pmix_regevents_info_t *reginfo;
+
+    reginfo = PMIX_NEW(pmix_regevents_info_t);
+    if (NULL == reginfo) {
+        return NULL;
+    }
+    reginfo->code = code;
+    pmix_list_append(&pmix_server_globals.events, &reginfo->super);
+    pmix_hash_table_set_value_uint32(&pmix_server_globals.events_index, (uint32_t) code, reginfo);
+    return reginfo;
+}
+
+static void event_reg_subscribe(pmix_regevents_info_t *reginfo, pmix_peer_events_info_t *prev)
+{
+    pmix_list_append(&reginfo->peers, &prev->super);
+    pmix_bitmap_set_bit(&reginfo->subscribers, prev->peer->index);
+}
+
+/* remove one peer registration from the given code, dropping the
+ * code itself once nobody remains registered for it. Returns true
+ * if the code was dropped */
+bool pmix_server_event_reg_remove(pmix_regevents_info_t *reginfo, pmix_peer_events_info_t *prev)
+{
+    pmix_peer_events_info_t *p;
+    bool found = false;
+
+    pmix_list_remove_item(&reginfo->peers, &prev->super);
+    /* the peer may have registered more than one handler for this code */
+    PMIX_LIST_FOREACH (p, &reginfo->peers, pmix_peer_events_info_t) {
+        if (p->peer->index == prev->peer->index) {
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        pmix_bitmap_clear_bit(&reginfo->subscribers, prev->peer->index);
+    }
+    PMIX_RELEASE(prev);
+
+    if (0 == pmix_list_get_size(&reginfo->peers)) {
+        pmix_hash_table_remove_value_uint32(&pmix_server_globals.events_index,
+                                            (uint32_t) reginfo->code);
+        pmix_list_remove_item(&pmix_server_globals.events, &reginfo->super);
+        PMIX_RELEASE(reginfo);
+        return true;
+    }
+    return false;
+}
+
 pmix_status_t pmix_server_register_events(pmix_peer_t *peer, pmix_buffer_t *buf,
                                           pmix_op_cbfunc_t cbfunc, void *cbdata)
 {
@@ -2260,11 +2410,10 @@ pmix_status_t pmix_server_register_events(pmix_peer_t *peer, pmix_buffer_t *buf,
     pmix_status_t *codes = NULL;
     pmix_info_t *info = NULL;
     size_t ninfo = 0, ncodes, n;
-    pmix_regevents_info_t *reginfo, *rptr;
+    pmix_regevents_info_t *reginfo;
     pmix_peer_events_info_t *prev = NULL;
     pmix_setup_caddy_t *scd;
     bool enviro_events = false;
-    bool found;
     pmix_proc_t *affected = NULL;
     size_t naffected = 0;
 
@@ -2359,43 +2508,9 @@ pmix_status_t pmix_server_register_events(pmix_peer_t *peer, pmix_buffer_t *buf,
      * default event handler. In that case, check only for default
      * handlers and add this request to it, if not already present */
     if (0 == ncodes) {
-        PMIX_LIST_FOREACH (reginfo, &pmix_server_globals.events, pmix_regevents_info_t) {
-            if (PMIX_MAX_ERR_CONSTANT == reginfo->code) {
-                /* both are default handlers */
-                prev = PMIX_NEW(pmix_peer_events_info_t);
-                if (NULL == prev) {
-                    rc = PMIX_ERR_NOMEM;
-                    goto cleanup;
-                }
-                PMIX_RETAIN(peer);
-                prev->peer = peer;
-                if (NULL != affected) {
-                    PMIX_PROC_CREATE(prev->affected, naffected);
-                    prev->naffected = naffected;
-                    memcpy(prev->affected, affected, naffected * sizeof(pmix_proc_t));
-                }
-                pmix_list_append(&reginfo->peers, &prev->super);
-                break;
-            }
-        }
-        rc = PMIX_OPERATION_SUCCEEDED;
-        goto cleanup;
-    }
-
-    /* store the event registration info so we can call the registered
-     * client when the server notifies the event */
-    for (n = 0; n < ncodes; n++) {
-        found = false;
-        PMIX_LIST_FOREACH (reginfo, &pmix_server_globals.events, pmix_regevents_info_t) {
-            if (PMIX_MAX_ERR_CONSTANT == reginfo->code) {
-                continue;
-            } else if (codes[n] == reginfo->code) {
-                found = true;
-                break;
-            }
-        }
-        if (found) {
-            /* found it - add this request */
+        reginfo = pmix_server_event_reg_find(PMIX_MAX_ERR_CONSTANT);
+        if (NULL != reginfo) {
+            /* both are default handlers */
             prev = PMIX_NEW(pmix_peer_events_info_t);
             if (NULL == prev) {
                 rc = PMIX_ERR_NOMEM;
@@ -2408,32 +2523,38 @@ pmix_status_t pmix_server_register_events(pmix_peer_t *peer, pmix_buffer_t *buf,
                 prev->naffected = naffected;
                 memcpy(prev->affected, affected, naffected * sizeof(pmix_proc_t));
             }
-            prev->enviro_events = enviro_events;
-            pmix_list_append(&reginfo->peers, &prev->super);
-        } else {
-            /* if we get here, then we didn't find an existing registration for this code */
-            rptr = PMIX_NEW(pmix_regevents_info_t);
-            if (NULL == rptr) {
-                rc = PMIX_ERR_NOMEM;
-                goto cleanup;
-            }
-            rptr->code = codes[n];
-            pmix_list_append(&pmix_server_globals.events, &rptr->super);
-            prev = PMIX_NEW(pmix_peer_events_info_t);
-            if (NULL == prev) {
+            event_reg_subscribe(reginfo, prev);
+        }
+        rc = PMIX_OPERATION_SUCCEEDED;
+        goto cleanup;
+    }
+
+    /* store the event registration info so we can call the registered
+     * client when the server notifies the event */
+    for (n = 0; n < ncodes; n++) {
+        reginfo = pmix_server_event_reg_find(codes[n]);
+        if (NULL == reginfo) {
+            /* we didn't find an existing registration for this code */
+            reginfo = event_reg_add(codes[n]);
+            if (NULL == reginfo) {
                 rc = PMIX_ERR_NOMEM;
                 goto cleanup;
             }
-            PMIX_RETAIN(peer);
-            prev->peer = peer;
-            if (NULL != affected) {
-                PMIX_PROC_CREATE(prev->affected, naffected);
-                prev->naffected = naffected;
-                memcpy(prev->affected, affected, naffected * sizeof(pmix_proc_t));
-            }
-            prev->enviro_events = enviro_events;
-            pmix_list_append(&rptr->peers, &prev->super);
         }
+        prev = PMIX_NEW(pmix_peer_events_info_t);
+        if (NULL == prev) {
+            rc = PMIX_ERR_NOMEM;
+            goto cleanup;
+        }
+        PMIX_RETAIN(peer);
+        prev->peer = peer;
+        if (NULL != affected) {
+            PMIX_PROC_CREATE(prev->affected, naffected);
+            prev->naffected = naffected;
+            memcpy(prev->affected, affected, naffected * sizeof(pmix_proc_t));
+        }
+        prev->enviro_events = enviro_events;
+        event_reg_subscribe(reginfo, prev);
     }
 
     /* if they asked for enviro events, call the local server */
@@ -2537,8 +2658,7 @@ void pmix_server_deregister_events(pmix_peer_t *peer, pmix_buffer_t *buf)
 {
     int32_t cnt;
     pmix_status_t rc, code;
-    pmix_regevents_info_t *reginfo = NULL;
-    pmix_regevents_info_t *reginfo_next;
+    pmix_regevents_info_t *reginfo;
     pmix_peer_events_info_t *prev;
 
     pmix_output_verbose(2, pmix_server_globals.event_output,
@@ -2550,23 +2670,15 @@ void pmix_server_deregister_events(pmix_peer_t *peer, pmix_buffer_t *buf)
     cnt = 1;
     PMIX_BFROPS_UNPACK(rc, peer, buf, &code, &cnt, PMIX_STATUS);
     while (PMIX_SUCCESS == rc) {
-        PMIX_LIST_FOREACH_SAFE (reginfo, reginfo_next, &pmix_server_globals.events,
-                                pmix_regevents_info_t) {
-            if (code == reginfo->code) {
-                /* found it - remove this peer from the list */
-                PMIX_LIST_FOREACH (prev, &reginfo->peers, pmix_peer_events_info_t) {
-                    if (prev->peer == peer) {
-                        /* found it */
-                        pmix_list_remove_item(&reginfo->peers, &prev->super);
-                        PMIX_RELEASE(prev);
-                        break;
-                    }
-                }
-                /* if all of the peers for this code are now gone, then remove it */
-                if (0 == pmix_list_get_size(&reginfo->peers)) {
-                    pmix_list_remove_item(&pmix_server_globals.events, &reginfo->super);
-                    /* if this was registered with the host, then deregister it */
-                    PMIX_RELEASE(reginfo);
+        reginfo = pmix_server_event_reg_find(code);
+        if (NULL != reginfo && pmix_bitmap_is_set_bit(&reginfo->subscribers, peer->index)) {
+            /* found it - remove this peer from the list */
+            PMIX_LIST_FOREACH (prev, &reginfo->peers, pmix_peer_events_info_t) {
+                if (prev->peer == peer) {
+                    /* found it - if all of the peers for this
+                     * code are now gone, then it is removed too */
+                    pmix_server_event_reg_remove(reginfo, prev);
+                    break;
                 }
             }
         }
@@ -2948,7 +3060,7 @@ pmix_status_t pmix_server_job_ctrl(pmix_peer_t *peer, pmix_buffer_t *buf,
     int32_t cnt, m;
     pmix_status_t rc;
     pmix_query_caddy_t *cd;
-    pmix_namespace_t *nptr, *tmp;
+    pmix_namespace_t *nptr;
     pmix_peer_t *pr;
     pmix_proc_t proc;
     size_t n;
@@ -2998,13 +3110,7 @@ pmix_status_t pmix_server_job_ctrl(pmix_peer_t *peer, pmix_buffer_t *buf,
     } else {
         for (n = 0; n < cd->ntargets; n++) {
             /* find the nspace of this proc */
-            nptr = NULL;
-            PMIX_LIST_FOREACH (tmp, &pmix_globals.nspaces, pmix_namespace_t) {
-                if (0 == strcmp(tmp->nspace, cd->targets[n].nspace)) {
-                    nptr = tmp;
-                    break;
-                }
-            }
+            nptr = pmix_nspace_lookup(cd->targets[n].nspace);
             if (NULL == nptr) {
                 nptr = PMIX_NEW(pmix_namespace_t);
                 if (NULL == nptr) {
@@ -3012,7 +3118,7 @@ pmix_status_t pmix_server_job_ctrl(pmix_peer_t *peer, pmix_buffer_t *buf,
                     goto exit;
                 }
                 nptr->nspace = strdup(cd->targets[n].nspace);
-                pmix_list_append(&pmix_globals.nspaces, &nptr->super);
+                pmix_nspace_add(nptr);
             }
             /* if the rank is wildcard, then we use the epilog for the nspace */
             if (PMIX_RANK_WILDCARD == cd->targets[n].rank) {
@@ -4065,7 +4171,7 @@ release:
     }
 
     /* remove the tracker from the list */
-    pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+    pmix_server_trk_remove(trk);
   //  PMIX_RELEASE(trk);
 
     /* we are done */
@@ -4390,7 +4496,7 @@ pmix_status_t pmix_server_grpconstruct(pmix_server_caddy_t *cd, pmix_buffer_t *b
                     pmix_event_del(&trk->ev);
                 }
                 /* remove the tracker from the list */
-                pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+                pmix_server_trk_remove(trk);
                 PMIX_RELEASE(trk);
                 PMIX_DESTRUCT(&bucket);
                 return rc;
@@ -4474,7 +4580,7 @@ pmix_status_t pmix_server_grpconstruct(pmix_server_caddy_t *cd, pmix_buffer_t *b
                 return PMIX_SUCCESS;
             }
             /* remove the tracker from the list */
-            pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+            pmix_server_trk_remove(trk);
             PMIX_RELEASE(trk);
             return rc;
         }
@@ -4627,7 +4733,7 @@ pmix_status_t pmix_server_grpdestruct(pmix_server_caddy_t *cd, pmix_buffer_t *bu
                 return PMIX_SUCCESS;
             }
             /* remove the tracker from the list */
-            pmix_list_remove_item(&pmix_server_globals.collectives, &trk->super);
+            pmix_server_trk_remove(trk);
             PMIX_RELEASE(trk);
             return rc;
         }
@@ -4972,6 +5078,8 @@ static void tcon(pmix_server_trkr_t *t)
     t->op_cbfunc = NULL;
     t->hybrid = false;
     t->cbdata = NULL;
+    t->sig = 0;
+    t->signext = NULL;
 }
 static void tdes(pmix_server_trkr_t *t)
 {
@@ -5140,10 +5248,12 @@ PMIX_CLASS_INSTANCE(pmix_peer_events_info_t, pmix_list_item_t, prevcon, prevdes)
 static void regcon(pmix_regevents_info_t *p)
 {
     PMIX_CONSTRUCT(&p->peers, pmix_list_t);
+    PMIX_CONSTRUCT(&p->subscribers, pmix_bitmap_t);
 }
 static void regdes(pmix_regevents_info_t *p)
 {
     PMIX_LIST_DESTRUCT(&p->peers);
+    PMIX_DESTRUCT(&p->subscribers);
 }
 PMIX_CLASS_INSTANCE(pmix_regevents_info_t, pmix_list_item_t, regcon, regdes);
 
@@ -25,6 +25,7 @@
 #include "src/include/pmix_types.h"
 
 #include "include/pmix_server.h"
+#include "src/class/pmix_bitmap.h"
 #include "src/class/pmix_hotel.h"
 #include "src/include/pmix_globals.h"
 #include "src/threads/pmix_threads.h"
@@ -139,7 +140,8 @@ PMIX_CLASS_DECLARATION(pmix_peer_events_info_t);
 
 typedef struct {
     pmix_list_item_t super;
-    pmix_list_t peers; // list of pmix_peer_events_info_t
+    pmix_list_t peers;         // list of pmix_peer_events_info_t
+    pmix_bitmap_t subscribers; // local client index of each peer on the list
     int code;
 } pmix_regevents_info_t;
 PMIX_CLASS_DECLARATION(pmix_regevents_info_t);
@@ -182,12 +184,18 @@ typedef struct {
     pmix_list_t nspaces;          // list of pmix_nspace_t for the nspaces we know about
     pmix_pointer_array_t clients; // array of pmix_peer_t local clients
     pmix_list_t collectives;      // list of active pmix_server_trkr_t
-    pmix_list_t remote_pnd; // list of pmix_dmdx_remote_t awaiting arrival of data fror servicing
-                            // remote req's
+    pmix_hash_table_t colltable;  // index of active trackers by signature
+    pmix_hash_table_t remote_pnd; // per-proc lists of pmix_dmdx_remote_t awaiting arrival of
+                                  // data for servicing remote req's, keyed by that proc
     pmix_list_t local_reqs;     // list of pmix_dmdx_local_t awaiting arrival of data from local neighbours
+    pmix_hash_table_t local_reqs_index; // index of local_reqs by the proc whose data is wanted
+    pmix_hash_table_t prefetched; // procs whose data we requested ahead of any local demand
+    pmix_list_t dmdx_batches;     // pmix_dmdx_batch_t dmodex requests held for batching by host
+    pmix_list_t dmdx_streams;     // per-nspace dmodex access patterns watched for prefetching
     pmix_list_t gdata;  // cache of data given to me for passing to all clients
     char **genvars;     // argv array of envars given to me for passing to all clients
     pmix_list_t events; // list of pmix_regevents_info_t registered events
+    pmix_hash_table_t events_index; // index of events by status code
     pmix_list_t groups; // list of pmix_group_t group memberships
     pmix_list_t iof;    // IO to be forwarded to clients
     pmix_list_t iof_residuals;  // leftover bytes waiting for newline
@@ -197,6 +205,12 @@ typedef struct {
     char *tmpdir;             // temporary directory for this server
     char *system_tmpdir;      // system tmpdir
     bool fence_localonly_opt; // local-only fence optimization
+    int dmodex_batch_window;  // usec to collect dmodex requests before passing them up (0 = off)
+    int dmodex_batch_max;     // pass collected dmodex requests up once this many are waiting
+    int dmodex_prefetch_depth;  // number of ranks to request ahead of a detected access pattern (0 = off)
+    int dmodex_prefetch_window; // consecutive same-stride requests needed to detect a pattern
+    uint64_t dmodex_prefetch_hits;   // requests satisfied by prefetched data
+    uint64_t dmodex_prefetch_misses; // requests that had to be passed up to the host
     // verbosity for server get operations
     int get_output;
     int get_verbose;
@@ -246,6 +260,20 @@ typedef struct {
 
 PMIX_EXPORT bool pmix_server_trk_update(pmix_server_trkr_t *trk);
 
+/* remove a tracker from the list of active collectives */
+PMIX_EXPORT void pmix_server_trk_remove(pmix_server_trkr_t *trk);
+
+/* access the pending direct modex requests by target proc */
+PMIX_EXPORT pmix_dmdx_local_t *pmix_dmdx_local_find(const char *nspace, pmix_rank_t rank);
+PMIX_EXPORT void pmix_dmdx_local_add(pmix_dmdx_local_t *lcd);
+PMIX_EXPORT void pmix_dmdx_local_remove(pmix_dmdx_local_t *lcd);
+PMIX_EXPORT void pmix_dmdx_remote_add(pmix_dmdx_remote_t *dcd);
+PMIX_EXPORT pmix_list_t *pmix_dmdx_remote_take(const char *nspace, pmix_rank_t rank);
+PMIX_EXPORT void pmix_dmdx_remote_purge(void);
+PMIX_EXPORT void pmix_dmdx_batch_purge(void);
+PMIX_EXPORT void pmix_dmdx_prefetch_purge(void);
+PMIX_EXPORT void pmix_dmdx_prefetch_purge_nspace(const char *nspace);
+
 PMIX_EXPORT void pmix_pending_nspace_requests(pmix_namespace_t *nptr);
 PMIX_EXPORT pmix_status_t pmix_pending_resolve(pmix_namespace_t *nptr, pmix_rank_t rank,
                                                pmix_status_t status, pmix_scope_t scope,
@@ -341,6 +369,11 @@ PMIX_EXPORT void pmix_server_message_handler(struct pmix_peer_t *pr, pmix_ptl_hd
 
 PMIX_EXPORT void pmix_server_purge_events(pmix_peer_t *peer, pmix_proc_t *proc);
 
+/* access the registered events by status code */
+PMIX_EXPORT pmix_regevents_info_t *pmix_server_event_reg_find(int code);
+PMIX_EXPORT bool pmix_server_event_reg_remove(pmix_regevents_info_t *reginfo,
+                                              pmix_peer_events_info_t *prev);
+
 PMIX_EXPORT pmix_status_t pmix_server_fabric_register(pmix_server_caddy_t *cd, pmix_buffer_t *buf,
                                                       pmix_info_cbfunc_t cbfunc);
 
@@ -641,6 +641,8 @@ PMIX_EXPORT int PMIx_tool_init(pmix_proc_t *proc, pmix_info_t info[], size_t nin
     PMIX_CONSTRUCT(&pmix_client_globals.pending_requests, pmix_list_t);
     PMIX_CONSTRUCT(&pmix_client_globals.peers, pmix_pointer_array_t);
     pmix_pointer_array_init(&pmix_client_globals.peers, 1, INT_MAX, 1);
+    PMIX_CONSTRUCT(&pmix_client_globals.negcache, pmix_hash_table_t);
+    pmix_hash_table_init(&pmix_client_globals.negcache, 256);
     pmix_client_globals.myserver = PMIX_NEW(pmix_peer_t);
     if (NULL == pmix_client_globals.myserver) {
         PMIX_RELEASE_THREAD(&pmix_global_lock);
@@ -1512,6 +1514,7 @@ PMIX_EXPORT pmix_status_t PMIx_tool_finalize(void)
             PMIX_RELEASE(peer);
         }
     }
+    PMIX_DESTRUCT(&pmix_client_globals.negcache);
 
     pmix_ptl_base_stop_listening();
 
@@ -1526,10 +1529,17 @@ PMIX_EXPORT pmix_status_t PMIx_tool_finalize(void)
     (void) pmix_mca_base_framework_close(&pmix_pnet_base_framework);
     PMIX_DESTRUCT(&pmix_server_globals.clients);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.collectives);
-    PMIX_LIST_DESTRUCT(&pmix_server_globals.remote_pnd);
+    PMIX_DESTRUCT(&pmix_server_globals.colltable);
+    pmix_dmdx_remote_purge();
+    pmix_dmdx_batch_purge();
+    pmix_dmdx_prefetch_purge();
+    PMIX_DESTRUCT(&pmix_server_globals.remote_pnd);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.local_reqs);
+    PMIX_DESTRUCT(&pmix_server_globals.local_reqs_index);
+    PMIX_DESTRUCT(&pmix_server_globals.prefetched);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.gdata);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.events);
+    PMIX_DESTRUCT(&pmix_server_globals.events_index);
     PMIX_LIST_DESTRUCT(&pmix_server_globals.iof);
 
     (void) pmix_mca_base_framework_close(&pmix_pfexec_base_framework);
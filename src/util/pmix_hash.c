@@ -51,6 +51,10 @@ typedef struct {
      received from this process */
     pmix_pointer_array_t data;
     pmix_pointer_array_t quals;
+    /* index of key id -> first pmix_dstor_t for that key. Values
+     * stored for the same key with different qualifiers are
+     * chained off the first one via the "next" field */
+    pmix_hash_table_t keys;
 } pmix_proc_data_t;
 static void pdcon(pmix_proc_data_t *p)
 {
@@ -58,6 +62,8 @@ static void pdcon(pmix_proc_data_t *p)
     pmix_pointer_array_init(&p->data, 128, INT_MAX, 128);
     PMIX_CONSTRUCT(&p->quals, pmix_pointer_array_t);
     pmix_pointer_array_init(&p->quals, 1, INT_MAX, 1);
+    PMIX_CONSTRUCT(&p->keys, pmix_hash_table_t);
+    pmix_hash_table_init(&p->keys, 32);
 }
 static void pddes(pmix_proc_data_t *p)
 {
@@ -75,6 +81,7 @@ static void pddes(pmix_proc_data_t *p)
         }
     }
     PMIX_DESTRUCT(&p->data);
+    PMIX_DESTRUCT(&p->keys);
     for (n=0; n < p->quals.size; n++) {
         darray = (pmix_data_array_t*)pmix_pointer_array_get_item(&p->quals, n);
         if (NULL != darray) {
@@ -98,6 +105,23 @@ static pmix_dstor_t *lookup_keyval(pmix_proc_data_t *proc, uint32_t kid,
 static pmix_proc_data_t *lookup_proc(pmix_hash_table_t *jtable, uint32_t id, bool create);
 static void erase_qualifiers(pmix_proc_data_t *proc,
                              uint32_t index);
+static void index_keyval(pmix_proc_data_t *proc, pmix_dstor_t *d);
+static void remove_keyval(pmix_proc_data_t *proc, uint32_t kid);
+
+/* add a registered key to the string -> key lookup table. The
+ * table is normally setup during init, but the attribute system
+ * can be loaded by tools before then - so init it on first use */
+static void keytable_add(pmix_regattr_input_t *ptr)
+{
+    if (NULL == ptr->string) {
+        return;
+    }
+    if (0 == pmix_globals.keytable.ht_capacity) {
+        pmix_hash_table_init(&pmix_globals.keytable, 1024);
+    }
+    pmix_hash_table_set_value_ptr(&pmix_globals.keytable, ptr->string,
+                                  strlen(ptr->string), ptr);
+}
 
 
 pmix_status_t pmix_hash_store(pmix_hash_table_t *table,
@@ -210,7 +234,7 @@ pmix_status_t pmix_hash_store(pmix_hash_table_t *table,
                         PMIX_DSTOR_RELEASE(hv);
                         return PMIX_ERR_BAD_PARAM;
                     }
-                    qarray[n].index = p->index;
+                    qarray[m].index = p->index;
                     PMIX_BFROPS_COPY(rc, pmix_globals.mypeer, (void **)&qarray[m].value, &qualifiers[n].value, PMIX_VALUE);
                     if (PMIX_SUCCESS != rc) {
                         PMIX_ERROR_LOG(rc);
@@ -245,6 +269,7 @@ pmix_status_t pmix_hash_store(pmix_hash_table_t *table,
         free(v);
     }
     pmix_pointer_array_add(&proc_data->data, hv);
+    index_keyval(proc_data, hv);
     return PMIX_SUCCESS;
 }
 
@@ -438,20 +463,7 @@ pmix_status_t pmix_hash_remove_data(pmix_hash_table_t *table,
                 if (NULL == key) {
                     PMIX_RELEASE(proc_data);
                 } else {
-                    for (n=0; n < proc_data->data.size; n++) {
-                        d = (pmix_dstor_t*)pmix_pointer_array_get_item(&proc_data->data, n);
-                        if (NULL != d && kid == d->index) {
-                            if (NULL != d->value) {
-                                PMIX_VALUE_RELEASE(d->value);
-                            }
-                            if (UINT32_MAX != d->qualindex) {
-                                erase_qualifiers(proc_data, d->qualindex);
-                            }
-                            free(d);
-                            pmix_pointer_array_set_item(&proc_data->data, n, NULL);
-                            break;
-                        }
-                    }
+                    remove_keyval(proc_data, kid);
                 }
             }
             rc = pmix_hash_table_get_next_key_uint32(table, &id, (void **) &proc_data, node,
@@ -489,38 +501,29 @@ pmix_status_t pmix_hash_remove_data(pmix_hash_table_t *table,
     }
 
     /* remove this item */
-    for (n=0; n < proc_data->data.size; n++) {
-        d = (pmix_dstor_t*)pmix_pointer_array_get_item(&proc_data->data, n);
-        if (NULL != d && kid == d->index) {
-            if (NULL != d->value) {
-                PMIX_VALUE_RELEASE(d->value);
-            }
-            if (UINT32_MAX != d->qualindex) {
-                erase_qualifiers(proc_data, d->qualindex);
-            }
-            free(d);
-            pmix_pointer_array_set_item(&proc_data->data, n, NULL);
-            break;
-        }
-    }
+    remove_keyval(proc_data, kid);
 
     return PMIX_SUCCESS;
 }
 
 /**
- * Find data for a given key in a given pmix_list_t.
+ * Find data for a given key in a given proc_data object.
  */
 static pmix_dstor_t *lookup_keyval(pmix_proc_data_t *proc_data, uint32_t kid,
                                    pmix_info_t *qualifiers, size_t nquals)
 {
-    pmix_dstor_t *d;
+    pmix_dstor_t *d = NULL;
     pmix_data_array_t *darray;
     pmix_qual_t *qarray;
     pmix_regattr_input_t *p;
     size_t m, numquals = 0, nq, nfound;
-    int n;
+    uint32_t *qids = NULL;
 
-    p = pmix_hash_lookup_key(kid, NULL);
+    /* get the first value stored against this key */
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint32(&proc_data->keys, kid, (void**)&d) ||
+        NULL == d) {
+        return NULL;
+    }
 
     if (NULL != qualifiers) {
         /* count the qualifiers */
@@ -532,58 +535,127 @@ static pmix_dstor_t *lookup_keyval(pmix_proc_data_t *proc_data, uint32_t kid,
         }
     }
 
-    for (n=0; n < proc_data->data.size; n++) {
-        d = (pmix_dstor_t*)pmix_pointer_array_get_item(&proc_data->data, n);
-        if (NULL == d) {
-            continue;
+    if (0 < numquals) {
+        /* translate the qualifier keys once rather than
+         * for every candidate value */
+        qids = (uint32_t*)pmix_malloc(nquals * sizeof(uint32_t));
+        if (NULL == qids) {
+            return NULL;
+        }
+        for (m=0; m < nquals; m++) {
+            qids[m] = UINT32_MAX;
+            /* if this isn't marked as a qualifier, skip it */
+            if (!PMIX_INFO_IS_QUALIFIER(&qualifiers[m])) {
+                continue;
+            }
+            p = pmix_hash_lookup_key(UINT32_MAX, qualifiers[m].key);
+            if (NULL == p) {
+                /* we don't know this key */
+                free(qids);
+                return NULL;
+            }
+            qids[m] = p->index;
         }
-        if (kid == d->index) {
-            if (0 < numquals) {
-                if (UINT32_MAX == d->qualindex) {
+    }
+
+    for (; NULL != d; d = d->next) {
+        if (0 < numquals) {
+            if (UINT32_MAX == d->qualindex) {
+                continue;
+            }
+            darray = (pmix_data_array_t*)pmix_pointer_array_get_item(&proc_data->quals, d->qualindex);
+            qarray = (pmix_qual_t*)darray->array;
+            nfound = 0;
+            /* check the qualifiers */
+            for (m=0; m < nquals; m++) {
+                /* if this isn't marked as a qualifier, skip it */
+                if (UINT32_MAX == qids[m]) {
                     continue;
                 }
-                darray = (pmix_data_array_t*)pmix_pointer_array_get_item(&proc_data->quals, d->qualindex);
-                qarray = (pmix_qual_t*)darray->array;
-                nfound = 0;
-                /* check the qualifiers */
-                for (m=0; m < nquals; m++) {
-                    /* if this isn't marked as a qualifier, skip it */
-                    if (!PMIX_INFO_IS_QUALIFIER(&qualifiers[m])) {
-                        continue;
-                    }
-                    p = pmix_hash_lookup_key(UINT32_MAX, qualifiers[m].key);
-                    if (NULL == p) {
-                        /* we don't know this key */
-                        return NULL;
-                    }
-                    for (nq=0; nq < darray->size; nq++) {
-                        /* see if the keys match */
-                        if (qarray[nq].index == p->index) {
-                            /* if the values don't match, then we reject
-                             * this entry */
-                            if (PMIX_EQUAL == PMIx_Value_compare(&qualifiers[m].value, qarray[nq].value)) {
-                                /* match! */
-                                ++nfound;
-                                break;
-                            }
+                for (nq=0; nq < darray->size; nq++) {
+                    /* see if the keys match */
+                    if (qarray[nq].index == qids[m]) {
+                        /* if the values don't match, then we reject
+                         * this entry */
+                        if (PMIX_EQUAL == PMIx_Value_compare(&qualifiers[m].value, qarray[nq].value)) {
+                            /* match! */
+                            ++nfound;
+                            break;
                         }
                     }
                 }
-                /* did we get a complete match? */
-                if (nfound == numquals) {
-                    return d;
-                }
-            } else {
-                /* if the stored key is also "unqualified",
-                 * then return it */
-                if (UINT32_MAX == d->qualindex) {
-                    return d;
-                }
+            }
+            /* did we get a complete match? */
+            if (nfound == numquals) {
+                break;
+            }
+        } else {
+            /* if the stored key is also "unqualified",
+             * then return it */
+            if (UINT32_MAX == d->qualindex) {
+                break;
             }
         }
     }
 
-    return NULL;
+    if (NULL != qids) {
+        free(qids);
+    }
+    return d;
+}
+
+/**
+ * Add a newly stored value to the key index of its proc_data
+ * object. Values for a key already in the index are appended
+ * to the end of its chain so they are searched in the order
+ * in which they were stored.
+ */
+static void index_keyval(pmix_proc_data_t *proc_data, pmix_dstor_t *d)
+{
+    pmix_dstor_t *head = NULL;
+
+    d->next = NULL;
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint32(&proc_data->keys, d->index, (void**)&head) ||
+        NULL == head) {
+        pmix_hash_table_set_value_uint32(&proc_data->keys, d->index, d);
+        return;
+    }
+    while (NULL != head->next) {
+        head = head->next;
+    }
+    head->next = d;
+}
+
+/**
+ * Remove the first value stored against the given key
+ */
+static void remove_keyval(pmix_proc_data_t *proc_data, uint32_t kid)
+{
+    pmix_dstor_t *d = NULL;
+    int n;
+
+    if (PMIX_SUCCESS != pmix_hash_table_get_value_uint32(&proc_data->keys, kid, (void**)&d) ||
+        NULL == d) {
+        return;
+    }
+    if (NULL == d->next) {
+        pmix_hash_table_remove_value_uint32(&proc_data->keys, kid);
+    } else {
+        pmix_hash_table_set_value_uint32(&proc_data->keys, kid, d->next);
+    }
+    for (n=0; n < proc_data->data.size; n++) {
+        if (d == pmix_pointer_array_get_item(&proc_data->data, n)) {
+            pmix_pointer_array_set_item(&proc_data->data, n, NULL);
+            break;
+        }
+    }
+    if (NULL != d->value) {
+        PMIX_VALUE_RELEASE(d->value);
+    }
+    if (UINT32_MAX != d->qualindex) {
+        erase_qualifiers(proc_data, d->qualindex);
+    }
+    free(d);
 }
 
 /**
@@ -617,6 +689,8 @@ void pmix_hash_register_key(uint32_t inid,
         pmix_pointer_array_set_item(&pmix_globals.keyindex, pmix_globals.next_keyid, ptr);
         ptr->index = pmix_globals.next_keyid;
         pmix_globals.next_keyid += 1;
+        /* and index it by string for fast lookup */
+        keytable_add(ptr);
         return;
     }
 
@@ -628,12 +702,12 @@ void pmix_hash_register_key(uint32_t inid,
     }
     /* store the pointer in the table */
     pmix_pointer_array_set_item(&pmix_globals.keyindex, inid, ptr);
+    keytable_add(ptr);
 }
 
 pmix_regattr_input_t* pmix_hash_lookup_key(uint32_t inid,
                                            const char *key)
 {
-    int id;
     pmix_regattr_input_t *ptr = NULL;
 
     if (UINT32_MAX == inid) {
@@ -641,28 +715,18 @@ pmix_regattr_input_t* pmix_hash_lookup_key(uint32_t inid,
             /* they have to give us something! */
             return NULL;
         }
+        /* both reserved and user-defined keys are indexed
+         * by their string in the keytable */
+        if (0 < pmix_globals.keytable.ht_capacity &&
+            PMIX_SUCCESS == pmix_hash_table_get_value_ptr(&pmix_globals.keytable,
+                                                          key, strlen(key),
+                                                          (void**)&ptr)) {
+            return ptr;
+        }
         if (PMIX_CHECK_RESERVED_KEY(key)) {
-            /* reserved keys are in the front of the table */
-            for (id = 0; id < PMIX_INDEX_BOUNDARY; id++) {
-                ptr = pmix_pointer_array_get_item(&pmix_globals.keyindex, id);
-                if (NULL != ptr) {
-                    if (0 == strcmp(key, ptr->string)) {
-                        return ptr;
-                    }
-                }
-            }
             /* reserved keys must already have been registered */
             return NULL;
         }
-        /* unreserved keys are at the back of the table */
-        for (id = PMIX_INDEX_BOUNDARY; id < pmix_globals.keyindex.size; id++) {
-            ptr = pmix_pointer_array_get_item(&pmix_globals.keyindex, id);
-            if (NULL != ptr) {
-                if (0 == strcmp(key, ptr->string)) {
-                    return ptr;
-                }
-            }
-        }
         /* we didn't find it - register it */
         ptr = (pmix_regattr_input_t*)pmix_malloc(sizeof(pmix_regattr_input_t));
         ptr->name = strdup(key);
@@ -0,0 +1,155 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Microbenchmark for the internal key-value hash storage. Stores
+ * N keys for each of M ranks into a single table and then times
+ * a series of fetches of randomly selected rank/key pairs.
+ *
+ * Usage: pmix_hash_bench [-k nkeys] [-r nranks] [-f nfetches]
+ */
+
+#include "src/include/pmix_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "include/pmix_tool.h"
+#include "src/class/pmix_hash_table.h"
+#include "src/class/pmix_list.h"
+#include "src/include/pmix_globals.h"
+#include "src/util/pmix_hash.h"
+
+static double elapsed(struct timeval *start, struct timeval *end)
+{
+    return (double) ((end->tv_sec * 1000000 + end->tv_usec)
+                     - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+int main(int argc, char **argv)
+{
+    pmix_proc_t myproc;
+    pmix_info_t info;
+    pmix_hash_table_t table;
+    pmix_kval_t kv;
+    pmix_value_t val;
+    pmix_list_t kvals;
+    pmix_kval_t *kp;
+    pmix_status_t rc;
+    struct timeval start, end;
+    char **keys;
+    int nkeys = 256, nranks = 128, nfetches = 1000000;
+    int n, k, r, opt, errors = 0;
+    double usecs;
+
+    while (-1 != (opt = getopt(argc, argv, "k:r:f:h"))) {
+        switch (opt) {
+        case 'k':
+            nkeys = strtol(optarg, NULL, 10);
+            break;
+        case 'r':
+            nranks = strtol(optarg, NULL, 10);
+            break;
+        case 'f':
+            nfetches = strtol(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-k nkeys] [-r nranks] [-f nfetches]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (0 >= nkeys || 0 >= nranks || 0 >= nfetches) {
+        fprintf(stderr, "All values must be positive\n");
+        return 1;
+    }
+
+    /* we only need the internal support - no server */
+    PMIX_INFO_LOAD(&info, PMIX_TOOL_DO_NOT_CONNECT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_tool_init(&myproc, &info, 1))) {
+        fprintf(stderr, "Init failed with error %s\n", PMIx_Error_string(rc));
+        return rc;
+    }
+    PMIX_INFO_DESTRUCT(&info);
+
+    keys = (char **) malloc(nkeys * sizeof(char *));
+    for (k = 0; k < nkeys; k++) {
+        if (0 > asprintf(&keys[k], "bench.key.%d", k)) {
+            return 1;
+        }
+    }
+
+    PMIX_CONSTRUCT(&table, pmix_hash_table_t);
+    pmix_hash_table_init(&table, 256);
+
+    /* store the data */
+    PMIX_CONSTRUCT(&kv, pmix_kval_t);
+    kv.value = &val;
+    val.type = PMIX_UINT32;
+    gettimeofday(&start, NULL);
+    for (r = 0; r < nranks; r++) {
+        for (k = 0; k < nkeys; k++) {
+            kv.key = keys[k];
+            val.data.uint32 = (uint32_t) (r * nkeys + k);
+            rc = pmix_hash_store(&table, r, &kv, NULL, 0);
+            if (PMIX_SUCCESS != rc) {
+                fprintf(stderr, "Store of key %s for rank %d failed: %s\n",
+                        keys[k], r, PMIx_Error_string(rc));
+                return 1;
+            }
+        }
+    }
+    gettimeofday(&end, NULL);
+    usecs = elapsed(&start, &end);
+    fprintf(stdout, "Stored %d keys for %d ranks in %.3f sec (%.3f usec/store)\n",
+            nkeys, nranks, usecs / 1000000.0, usecs / ((double) nkeys * nranks));
+    kv.key = NULL;
+    kv.value = NULL;
+    PMIX_DESTRUCT(&kv);
+
+    /* time the random fetches */
+    srand(12345);
+    PMIX_CONSTRUCT(&kvals, pmix_list_t);
+    gettimeofday(&start, NULL);
+    for (n = 0; n < nfetches; n++) {
+        r = rand() % nranks;
+        k = rand() % nkeys;
+        rc = pmix_hash_fetch(&table, r, keys[k], NULL, 0, &kvals);
+        if (PMIX_SUCCESS != rc) {
+            ++errors;
+            continue;
+        }
+        kp = (pmix_kval_t *) pmix_list_remove_first(&kvals);
+        if (NULL == kp || (uint32_t) (r * nkeys + k) != kp->value->data.uint32) {
+            ++errors;
+        }
+        if (NULL != kp) {
+            PMIX_RELEASE(kp);
+        }
+    }
+    gettimeofday(&end, NULL);
+    PMIX_LIST_DESTRUCT(&kvals);
+    usecs = elapsed(&start, &end);
+    fprintf(stdout, "Fetched %d random values in %.3f sec (%.3f usec/fetch)\n",
+            nfetches, usecs / 1000000.0, usecs / (double) nfetches);
+
+    pmix_hash_remove_data(&table, PMIX_RANK_WILDCARD, NULL);
+    PMIX_DESTRUCT(&table);
+    for (k = 0; k < nkeys; k++) {
+        free(keys[k]);
+    }
+    free(keys);
+
+    PMIx_tool_finalize();
+
+    if (0 < errors) {
+        fprintf(stderr, "%d fetches FAILED\n", errors);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Microbenchmark for registering a large namespace. Acts as a server,
+ * registers a job of N procs with the usual per-proc data, and then
+ * times packing that job's info for delivery to a local client - the
+ * payload every client of the job is sent when it connects.
+ *
+ * Usage: pmix_register_bench [-n nprocs] [-r reps]
+ */
+
+#include "src/include/pmix_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "include/pmix_server.h"
+#include "src/include/pmix_globals.h"
+#include "src/mca/bfrops/bfrops.h"
+#include "src/mca/gds/gds.h"
+
+#define BENCH_NSPACE "regbench"
+
+static double elapsed(struct timeval *start, struct timeval *end)
+{
+    return (double) ((end->tv_sec * 1000000 + end->tv_usec)
+                     - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+/* cpu time of the calling thread in usec - unlike the wall
+ * clock, this does not count time the thread was not running */
+static double cputime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (double) ts.tv_sec * 1000000.0 + (double) ts.tv_nsec / 1000.0;
+}
+
+int main(int argc, char **argv)
+{
+    pmix_server_module_t mymodule;
+    pmix_nspace_t nspace;
+    pmix_info_t *info, *pinfo;
+    pmix_data_array_t *darray;
+    pmix_namespace_t *nptr;
+    pmix_peer_t *peer;
+    pmix_buffer_t *reply;
+    pmix_status_t rc;
+    struct timeval start, end;
+    char hostname[PMIX_MAXHOSTNAMELEN] = {0};
+    uint32_t nprocs = 100000, n;
+    uint16_t u16;
+    size_t ninfo, payload = 0;
+    int nreps = 5, r, opt;
+    double usecs, cpu, best = 0.0, bestcpu = 0.0;
+
+    while (-1 != (opt = getopt(argc, argv, "n:r:h"))) {
+        switch (opt) {
+        case 'n':
+            nprocs = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            nreps = strtol(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-n nprocs] [-r reps]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (0 == nprocs || 0 >= nreps) {
+        fprintf(stderr, "All values must be positive\n");
+        return 1;
+    }
+
+    /* we never talk to a client, so the host need not support anything */
+    memset(&mymodule, 0, sizeof(mymodule));
+    if (PMIX_SUCCESS != (rc = PMIx_server_init(&mymodule, NULL, 0))) {
+        fprintf(stderr, "Init failed with error %s\n", PMIx_Error_string(rc));
+        return rc;
+    }
+    gethostname(hostname, sizeof(hostname) - 1);
+    PMIX_LOAD_NSPACE(nspace, BENCH_NSPACE);
+
+    /* the job-level info plus one proc data array for each rank */
+    ninfo = 3;
+    PMIX_INFO_CREATE(info, ninfo + nprocs);
+    PMIX_INFO_LOAD(&info[0], PMIX_JOB_SIZE, &nprocs, PMIX_UINT32);
+    PMIX_INFO_LOAD(&info[1], PMIX_LOCAL_SIZE, &nprocs, PMIX_UINT32);
+    PMIX_INFO_LOAD(&info[2], PMIX_HOSTNAME, hostname, PMIX_STRING);
+    for (n = 0; n < nprocs; n++) {
+        PMIX_DATA_ARRAY_CREATE(darray, 4, PMIX_INFO);
+        pinfo = (pmix_info_t *) darray->array;
+        PMIX_INFO_LOAD(&pinfo[0], PMIX_RANK, &n, PMIX_PROC_RANK);
+        u16 = (uint16_t) n;
+        PMIX_INFO_LOAD(&pinfo[1], PMIX_LOCAL_RANK, &u16, PMIX_UINT16);
+        PMIX_INFO_LOAD(&pinfo[2], PMIX_NODE_RANK, &u16, PMIX_UINT16);
+        PMIX_INFO_LOAD(&pinfo[3], PMIX_HOSTNAME, hostname, PMIX_STRING);
+        PMIX_INFO_LOAD(&info[ninfo + n], PMIX_PROC_DATA, darray, PMIX_DATA_ARRAY);
+        PMIX_DATA_ARRAY_FREE(darray);
+    }
+
+    /* a single local client, so the packed payload is not kept
+     * and every rep below packs it again */
+    gettimeofday(&start, NULL);
+    rc = PMIx_server_register_nspace(nspace, 1, info, ninfo + nprocs, NULL, NULL);
+    gettimeofday(&end, NULL);
+    PMIX_INFO_FREE(info, ninfo + nprocs);
+    if (PMIX_SUCCESS != rc && PMIX_OPERATION_SUCCEEDED != rc) {
+        fprintf(stderr, "Register of %u procs failed: %s\n", nprocs, PMIx_Error_string(rc));
+        return 1;
+    }
+    usecs = elapsed(&start, &end);
+    fprintf(stdout, "Registered a %u proc nspace in %.3f sec\n", nprocs, usecs / 1000000.0);
+
+    /* stand in for a client of the job - it speaks our own protocol */
+    nptr = pmix_nspace_lookup(BENCH_NSPACE);
+    if (NULL == nptr) {
+        fprintf(stderr, "Registered nspace not found\n");
+        return 1;
+    }
+    nptr->compat = pmix_globals.mypeer->nptr->compat;
+    peer = PMIX_NEW(pmix_peer_t);
+    PMIX_RETAIN(nptr);
+    peer->nptr = nptr;
+    peer->info = PMIX_NEW(pmix_rank_info_t);
+    peer->info->pname.nspace = strdup(BENCH_NSPACE);
+    peer->info->pname.rank = 0;
+
+    for (r = 0; r < nreps; r++) {
+        reply = PMIX_NEW(pmix_buffer_t);
+        gettimeofday(&start, NULL);
+        cpu = cputime();
+        PMIX_GDS_REGISTER_JOB_INFO(rc, peer, reply);
+        cpu = cputime() - cpu;
+        gettimeofday(&end, NULL);
+        if (PMIX_SUCCESS != rc) {
+            fprintf(stderr, "Packing the job info failed: %s\n", PMIx_Error_string(rc));
+            return 1;
+        }
+        payload = PMIX_BUFFER_PAYLOAD_SIZE(reply);
+        PMIX_RELEASE(reply);
+        usecs = elapsed(&start, &end);
+        if (0 == r || usecs < best) {
+            best = usecs;
+        }
+        if (0 == r || cpu < bestcpu) {
+            bestcpu = cpu;
+        }
+    }
+    fprintf(stdout, "Packed the job info (%lu bytes) in %.3f msec, %.3f msec cpu (best of %d)\n",
+            (unsigned long) payload, best / 1000.0, bestcpu / 1000.0, nreps);
+
+    PMIX_RELEASE(peer);
+    PMIx_server_finalize();
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Helpers shared by the simple benchmark clients: integer option
+ * parsing, timers, and querying the server's performance counters.
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+typedef struct {
+    const char *opt;  // short form, e.g. "-i"
+    const char *lopt; // long form, e.g. "--iters" - may be NULL
+    unsigned long *value;
+} simpbench_opt_t;
+
+/* set the integer options found in argv from the table, which is
+ * terminated by an entry with a NULL opt. Arguments not in the table
+ * are ignored */
+static inline void simpbench_parse_opts(int argc, char **argv, simpbench_opt_t *opts)
+{
+    simpbench_opt_t *op;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        for (op = opts; NULL != op->opt; op++) {
+            if (0 == strcmp(argv[i], op->opt)
+                || (NULL != op->lopt && 0 == strcmp(argv[i], op->lopt))) {
+                break;
+            }
+        }
+        if (NULL == op->opt) {
+            continue;
+        }
+        if (NULL == argv[i + 1]) {
+            fprintf(stderr, "Error: %s requires an integer argument\n", argv[i]);
+            exit(1);
+        }
+        *op->value = strtoul(argv[i + 1], NULL, 10);
+        ++i;
+    }
+}
+
+/* the -n (elements per array) and -i (passes averaged) options of
+ * the pack/encode microbenchmarks, both of which must be positive */
+static inline void simpbench_array_opts(int argc, char **argv, int32_t *count, int *iters)
+{
+    unsigned long n = *count, i = *iters;
+    simpbench_opt_t opts[] = {{"-n", NULL, &n}, {"-i", NULL, &i}, {NULL, NULL, NULL}};
+
+    simpbench_parse_opts(argc, argv, opts);
+    if (0 == n || INT32_MAX < n || 0 == i || INT_MAX < i) {
+        fprintf(stderr, "Error: -n and -i must be positive\n");
+        exit(1);
+    }
+    *count = (int32_t) n;
+    *iters = (int) i;
+}
+
+/* wall clock time in usec - comparable across procs on a node */
+static inline uint64_t simpbench_usec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (uint64_t) tv.tv_sec * 1000000 + (uint64_t) tv.tv_usec;
+}
+
+/* monotonic time in seconds for timing short loops */
+static inline double simpbench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+}
+
+/* return the value of a uint64 counter the server reports via
+ * PMIx_Query_info, or zero if it doesn't */
+static inline uint64_t simpbench_query_counter(const char *key)
+{
+    pmix_query_t query;
+    pmix_info_t *results = NULL;
+    size_t nresults = 0;
+    uint64_t count = 0;
+    pmix_status_t rc;
+
+    PMIX_QUERY_CONSTRUCT(&query);
+    PMIX_ARGV_APPEND(rc, query.keys, key);
+    if (PMIX_SUCCESS == rc) {
+        rc = PMIx_Query_info(&query, 1, &results, &nresults);
+    }
+    if (PMIX_SUCCESS == rc && 0 < nresults && PMIX_UINT64 == results[0].value.type) {
+        count = results[0].value.data.uint64;
+    }
+    if (NULL != results) {
+        PMIX_INFO_FREE(results, nresults);
+    }
+    PMIX_QUERY_DESTRUCT(&query);
+    return count;
+}
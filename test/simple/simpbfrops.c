@@ -0,0 +1,216 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Pack/unpack microbenchmark: rank 0 packs and then unpacks arrays of
+ * fixed-width integers, ranks, procs, strings, and job-info and modex
+ * style info arrays using the buffer operations negotiated with its
+ * server, and reports the average time and packed size per element
+ * for each. The unpacked values are checked against the originals.
+ *
+ * Options are -n for the number of elements in each array (default
+ * 100000) and -i for the number of passes averaged (default 10), e.g.:
+ *
+ *   simptest -n 1 -e ./simpbfrops -n 1000000 -i 20
+ *
+ * To compare wire formats, run it again with a module excluded, e.g.
+ * with PMIX_MCA_bfrops=^v5compact in the environment.
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+static pmix_proc_t myproc;
+
+/* pack and unpack the given array iters times, reporting the
+ * average ns per element for each direction */
+static int bench(const char *name, pmix_data_type_t type, void *src, void *dest,
+                 size_t elsize, int32_t count, int iters)
+{
+    pmix_data_buffer_t buf;
+    pmix_status_t rc;
+    double packtime = 0.0, unpacktime = 0.0, start;
+    size_t packed = 0;
+    int32_t n;
+    int i, j;
+    char **sdest;
+    pmix_info_t *isrc, *idest;
+
+    for (i = 0; i < iters; i++) {
+        PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+        start = simpbench_now();
+        rc = PMIx_Data_pack(NULL, &buf, src, count, type);
+        packtime += simpbench_now() - start;
+        packed = buf.bytes_used;
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Pack of %s failed: %s", name, PMIx_Error_string(rc));
+            PMIX_DATA_BUFFER_DESTRUCT(&buf);
+            return 1;
+        }
+        memset(dest, 0, elsize * count);
+        n = count;
+        start = simpbench_now();
+        rc = PMIx_Data_unpack(NULL, &buf, dest, &n, type);
+        unpacktime += simpbench_now() - start;
+        PMIX_DATA_BUFFER_DESTRUCT(&buf);
+        if (PMIX_SUCCESS != rc || n != count) {
+            pmix_output(0, "Unpack of %s failed: %s", name, PMIx_Error_string(rc));
+            return 1;
+        }
+        if (PMIX_STRING == type) {
+            sdest = (char **) dest;
+            for (j = 0; j < count; j++) {
+                if (0 != strcmp(sdest[j], ((char **) src)[j])) {
+                    pmix_output(0, "Unpack of %s returned the wrong value", name);
+                    return 1;
+                }
+                free(sdest[j]);
+            }
+        } else if (PMIX_INFO == type) {
+            isrc = (pmix_info_t *) src;
+            idest = (pmix_info_t *) dest;
+            for (j = 0; j < count; j++) {
+                if (!PMIX_CHECK_KEY(&idest[j], isrc[j].key)
+                    || PMIX_EQUAL != PMIx_Value_compare(&idest[j].value, &isrc[j].value)) {
+                    pmix_output(0, "Unpack of %s returned the wrong value", name);
+                    return 1;
+                }
+                PMIX_INFO_DESTRUCT(&idest[j]);
+            }
+        } else if (0 != memcmp(src, dest, elsize * count)) {
+            pmix_output(0, "Unpack of %s returned the wrong value", name);
+            return 1;
+        }
+    }
+    fprintf(stdout, "%-10s pack %8.2f ns/elem  unpack %8.2f ns/elem  %8.2f bytes/elem\n", name,
+            1.0e9 * packtime / ((double) iters * count),
+            1.0e9 * unpacktime / ((double) iters * count), (double) packed / count);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int rc, i, iters = 10;
+    int32_t count = 100000;
+    uint32_t *u32, *u32out;
+    uint64_t *u64, *u64out;
+    pmix_rank_t *ranks, *ranksout;
+    pmix_proc_t *procs, *procsout;
+    char **strs, **strsout;
+    pmix_info_t *jinfo, *jinfoout, *minfo, *minfoout;
+    pmix_proc_t pt;
+    pmix_byte_object_t bo;
+    uint16_t lrank;
+    char ep[32];
+    int errors = 0;
+
+    simpbench_array_opts(argc, argv, &count, &iters);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+    if (0 != myproc.rank) {
+        goto done;
+    }
+
+    u32 = (uint32_t *) malloc(count * sizeof(uint32_t));
+    u32out = (uint32_t *) malloc(count * sizeof(uint32_t));
+    u64 = (uint64_t *) malloc(count * sizeof(uint64_t));
+    u64out = (uint64_t *) malloc(count * sizeof(uint64_t));
+    ranks = (pmix_rank_t *) malloc(count * sizeof(pmix_rank_t));
+    ranksout = (pmix_rank_t *) malloc(count * sizeof(pmix_rank_t));
+    procs = (pmix_proc_t *) malloc(count * sizeof(pmix_proc_t));
+    procsout = (pmix_proc_t *) malloc(count * sizeof(pmix_proc_t));
+    strs = (char **) malloc(count * sizeof(char *));
+    strsout = (char **) malloc(count * sizeof(char *));
+    jinfo = (pmix_info_t *) malloc(count * sizeof(pmix_info_t));
+    jinfoout = (pmix_info_t *) malloc(count * sizeof(pmix_info_t));
+    minfo = (pmix_info_t *) malloc(count * sizeof(pmix_info_t));
+    minfoout = (pmix_info_t *) malloc(count * sizeof(pmix_info_t));
+    for (i = 0; i < count; i++) {
+        u32[i] = (uint32_t) i * 2654435761u;
+        u64[i] = ((uint64_t) u32[i] << 32) | (uint64_t) i;
+        ranks[i] = i;
+        PMIX_LOAD_PROCID(&procs[i], myproc.nspace, i);
+        strs[i] = (char *) malloc(16);
+        snprintf(strs[i], 16, "node%06d", i);
+        /* the sort of per-proc data found in job info */
+        switch (i % 4) {
+        case 0:
+            PMIX_INFO_LOAD(&jinfo[i], PMIX_RANK, &ranks[i], PMIX_PROC_RANK);
+            break;
+        case 1:
+            lrank = i % 64;
+            PMIX_INFO_LOAD(&jinfo[i], PMIX_LOCAL_RANK, &lrank, PMIX_UINT16);
+            break;
+        case 2:
+            PMIX_INFO_LOAD(&jinfo[i], PMIX_HOSTNAME, strs[i], PMIX_STRING);
+            break;
+        default:
+            PMIX_LOAD_PROCID(&pt, myproc.nspace, PMIX_RANK_WILDCARD);
+            PMIX_INFO_LOAD(&jinfo[i], PMIX_PROCID, &pt, PMIX_PROC);
+            break;
+        }
+        /* and the sort found in a modex - endpoint blobs and addresses */
+        if (0 == i % 2) {
+            memset(ep, i % 251, sizeof(ep));
+            bo.bytes = ep;
+            bo.size = sizeof(ep);
+            PMIX_INFO_LOAD(&minfo[i], "pmix.test.ep", &bo, PMIX_BYTE_OBJECT);
+        } else {
+            PMIX_INFO_LOAD(&minfo[i], "pmix.test.addr", strs[i], PMIX_STRING);
+        }
+    }
+
+    fprintf(stdout, "Packing %d elements, averaged over %d passes\n", (int) count, iters);
+    errors += bench("UINT32", PMIX_UINT32, u32, u32out, sizeof(uint32_t), count, iters);
+    errors += bench("UINT64", PMIX_UINT64, u64, u64out, sizeof(uint64_t), count, iters);
+    errors += bench("PROC_RANK", PMIX_PROC_RANK, ranks, ranksout, sizeof(pmix_rank_t), count,
+                    iters);
+    errors += bench("PROC", PMIX_PROC, procs, procsout, sizeof(pmix_proc_t), count, iters);
+    errors += bench("STRING", PMIX_STRING, strs, strsout, sizeof(char *), count, iters);
+    errors += bench("JOBINFO", PMIX_INFO, jinfo, jinfoout, sizeof(pmix_info_t), count, iters);
+    errors += bench("MODEX", PMIX_INFO, minfo, minfoout, sizeof(pmix_info_t), count, iters);
+
+    for (i = 0; i < count; i++) {
+        free(strs[i]);
+        PMIX_INFO_DESTRUCT(&jinfo[i]);
+        PMIX_INFO_DESTRUCT(&minfo[i]);
+    }
+    free(u32);
+    free(u32out);
+    free(u64);
+    free(u64out);
+    free(ranks);
+    free(ranksout);
+    free(procs);
+    free(procsout);
+    free(strs);
+    free(strsout);
+    free(jinfo);
+    free(jinfoout);
+    free(minfo);
+    free(minfoout);
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
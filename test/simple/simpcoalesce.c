@@ -0,0 +1,148 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Event coalescing driver: every rank registers a handler for the same
+ * event and then reports that event naming itself as the affected proc,
+ * mimicking a storm of abort notifications. Each rank counts how many
+ * times its handler ran and how many affected procs it was told about.
+ * Rank 0 reports those numbers along with how many of the events it
+ * received were merged into another. The handler also checks that
+ * every one of the ninfo entries it was given is filled in - a merged
+ * event must not hand it blank trailing slots.
+ *
+ * Compare runs with and without coalescing, e.g.:
+ *
+ *   simptest -n 16 -e ./simpcoalesce
+ *   PMIX_MCA_pmix_event_coalesce=1 simptest -n 16 -e ./simpcoalesce
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "src/include/pmix_globals.h"
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+#define SIMPCOALESCE_EVENT (PMIX_EXTERNAL_ERR_BASE - 1)
+
+static pmix_proc_t myproc;
+static volatile int ncalls = 0;
+static volatile size_t naffected = 0;
+static volatile int nblank = 0;
+
+static void handler(size_t evhdlr_registration_id, pmix_status_t status,
+                    const pmix_proc_t *source, pmix_info_t info[], size_t ninfo,
+                    pmix_info_t results[], size_t nresults,
+                    pmix_event_notification_cbfunc_fn_t cbfunc, void *cbdata)
+{
+    size_t n;
+
+    PMIX_HIDE_UNUSED_PARAMS(evhdlr_registration_id, status, source, results, nresults);
+
+    ++ncalls;
+    for (n = 0; n < ninfo; n++) {
+        if (0 == strlen(info[n].key)) {
+            ++nblank;
+        } else if (PMIX_CHECK_KEY(&info[n], PMIX_EVENT_AFFECTED_PROC)) {
+            naffected += 1;
+        } else if (PMIX_CHECK_KEY(&info[n], PMIX_EVENT_AFFECTED_PROCS)) {
+            naffected += info[n].value.data.darray->size;
+        }
+    }
+    if (NULL != cbfunc) {
+        cbfunc(PMIX_EVENT_ACTION_COMPLETE, NULL, 0, NULL, NULL, cbdata);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int rc, i, errors = 0;
+    pmix_proc_t proc;
+    pmix_value_t *val = NULL;
+    pmix_status_t code = SIMPCOALESCE_EVENT;
+    pmix_info_t info;
+    uint32_t nprocs;
+
+    PMIX_HIDE_UNUSED_PARAMS(argc, argv);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+
+    /* register for the event - blocking registration returns the handler id */
+    rc = PMIx_Register_event_handler(&code, 1, NULL, 0, handler, NULL, NULL);
+    if (0 > rc) {
+        pmix_output(0, "Rank %d: PMIx_Register_event_handler failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* make sure everyone is listening */
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* report ourselves */
+    PMIX_INFO_LOAD(&info, PMIX_EVENT_AFFECTED_PROC, &myproc, PMIX_PROC);
+    rc = PMIx_Notify_event(code, &myproc, PMIX_RANGE_NAMESPACE, &info, 1, NULL, NULL);
+    PMIX_INFO_DESTRUCT(&info);
+    if (PMIX_SUCCESS != rc) {
+        pmix_output(0, "Rank %d: PMIx_Notify_event failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* give the events - and any coalescing window - time to play out */
+    for (i = 0; i < 100 && naffected < nprocs - 1; i++) {
+        usleep(100000);
+    }
+
+    if (0 == myproc.rank) {
+        fprintf(stdout, "Event storm of %u procs: handler ran %d times for %lu affected procs\n",
+                nprocs, ncalls, (unsigned long) naffected);
+        fprintf(stdout, "Events coalesced: %lu\n",
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_EVENTS_COALESCED));
+    }
+    if (0 < nblank) {
+        pmix_output(0, "Rank %d: handler was given %d blank info entries", myproc.rank, nblank);
+        ++errors;
+    }
+
+    rc = PMIx_Fence(&proc, 1, NULL, 0);
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
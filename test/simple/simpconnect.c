@@ -0,0 +1,129 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Connect storm driver: every rank is started at about the same time
+ * and immediately connects to the server by calling PMIx_Init. Each
+ * rank records when it started and how long its connection took, and
+ * rank 0 reports the min, avg, and max connect time along with the
+ * time from the first rank starting to the last one being connected.
+ *
+ * Compare the server handling all handshakes on its progress thread
+ * against a pool of handshake threads, e.g. (the pool only takes the
+ * reads of the connection requests off the progress thread - the
+ * credentials are still validated there, one at a time):
+ *
+ *   PMIX_MCA_ptl_base_handshake_threads=0 simptest -n 512 -e ./simpconnect
+ *   PMIX_MCA_ptl_base_handshake_threads=8 simptest -n 512 -e ./simpconnect
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+static pmix_proc_t myproc;
+
+int main(void)
+{
+    int rc, i;
+    uint32_t nprocs;
+    uint64_t start, end, dt, first = UINT64_MAX, last = 0, min = UINT64_MAX, max = 0;
+    double sum = 0.0;
+    pmix_value_t value, *val = NULL;
+    pmix_proc_t proc;
+    pmix_info_t info;
+    bool flag = true;
+    int errors = 0;
+
+    /* connect to the server */
+    start = simpbench_usec();
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "PMIx_Init failed: %s", PMIx_Error_string(rc));
+        exit(1);
+    }
+    end = simpbench_usec();
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+
+    /* share our timings */
+    value.type = PMIX_UINT64;
+    value.data.uint64 = start;
+    PMIx_Put(PMIX_GLOBAL, "simpconnect.start", &value);
+    value.data.uint64 = end;
+    PMIx_Put(PMIX_GLOBAL, "simpconnect.end", &value);
+    PMIx_Commit();
+    PMIX_INFO_LOAD(&info, PMIX_COLLECT_DATA, &flag, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, &info, 1))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == myproc.rank) {
+        for (i = 0; i < (int) nprocs; i++) {
+            proc.rank = i;
+            if (PMIX_SUCCESS != PMIx_Get(&proc, "simpconnect.start", NULL, 0, &val)) {
+                ++errors;
+                continue;
+            }
+            start = val->data.uint64;
+            PMIX_VALUE_RELEASE(val);
+            if (PMIX_SUCCESS != PMIx_Get(&proc, "simpconnect.end", NULL, 0, &val)) {
+                ++errors;
+                continue;
+            }
+            end = val->data.uint64;
+            PMIX_VALUE_RELEASE(val);
+            dt = end - start;
+            if (dt < min) {
+                min = dt;
+            }
+            if (dt > max) {
+                max = dt;
+            }
+            sum += (double) dt;
+            if (start < first) {
+                first = start;
+            }
+            if (end > last) {
+                last = end;
+            }
+        }
+        fprintf(stdout, "Connect storm of %u procs (handshake threads=%s)\n", nprocs,
+                (NULL == getenv("PMIX_MCA_ptl_base_handshake_threads"))
+                    ? "default"
+                    : getenv("PMIX_MCA_ptl_base_handshake_threads"));
+        fprintf(stdout, "PMIx_Init time (usec): min %lu avg %.1f max %lu\n", (unsigned long) min,
+                sum / (double) nprocs, (unsigned long) max);
+        fprintf(stdout, "All procs connected within %lu usec\n", (unsigned long) (last - first));
+    }
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
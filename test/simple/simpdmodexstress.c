@@ -0,0 +1,185 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Direct modex stress driver, based on simpdmodex: every rank posts
+ * non-blocking gets for the data of up to "count" other ranks before
+ * any of them have committed, so the server ends up holding about
+ * nprocs * count pending requests. Each rank then commits its own
+ * data and times how long it takes for all of its gets to complete.
+ * Rank 0 reports the min, avg, and max of that drain time.
+ *
+ * Sweep the number of outstanding requests to see how the server
+ * scales, e.g.:
+ *
+ *   simptest -n 64 -e ./simpdmodexstress -c 1
+ *   simptest -n 64 -e ./simpdmodexstress -c 16
+ *   simptest -n 64 -e ./simpdmodexstress -c 63
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "src/include/pmix_globals.h"
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+#define STRESS_KEY "simpdmodexstress.data"
+
+static pmix_proc_t myproc;
+static volatile uint32_t getcount = 0;
+static volatile uint32_t errors = 0;
+
+static void valcbfunc(pmix_status_t status, pmix_value_t *val, void *cbdata)
+{
+    PMIX_HIDE_UNUSED_PARAMS(cbdata);
+
+    if (PMIX_SUCCESS != status) {
+        pmix_output(0, "Rank %d: PMIx_Get_nb failed: %s", myproc.rank, PMIx_Error_string(status));
+        ++errors;
+    } else if (PMIX_UINT64 != val->type) {
+        pmix_output(0, "Rank %d: PMIx_Get_nb returned wrong type: %d", myproc.rank, val->type);
+        ++errors;
+    }
+    getcount++;
+}
+
+static void report(const char *what, pmix_proc_t *proc, uint32_t nprocs, const char *key)
+{
+    pmix_value_t *val;
+    uint64_t min = UINT64_MAX, max = 0;
+    double sum = 0.0;
+    uint32_t n;
+
+    for (n = 0; n < nprocs; n++) {
+        proc->rank = n;
+        if (PMIX_SUCCESS != PMIx_Get(proc, key, NULL, 0, &val)) {
+            continue;
+        }
+        if (val->data.uint64 < min) {
+            min = val->data.uint64;
+        }
+        if (val->data.uint64 > max) {
+            max = val->data.uint64;
+        }
+        sum += (double) val->data.uint64;
+        PMIX_VALUE_RELEASE(val);
+    }
+    fprintf(stdout, "%s (usec): min %lu avg %.1f max %lu\n", what, (unsigned long) min,
+            sum / (double) nprocs, (unsigned long) max);
+}
+
+int main(int argc, char **argv)
+{
+    int rc;
+    pmix_value_t value, *val = NULL;
+    pmix_proc_t proc;
+    pmix_info_t info;
+    uint32_t nprocs, n, target;
+    unsigned long count = UINT32_MAX, sleeptime = 1;
+    simpbench_opt_t opts[] = {{"-c", "--count", &count},
+                              {"-s", "--sleep", &sleeptime},
+                              {NULL, NULL, NULL}};
+    uint64_t start, drain;
+    bool flag = true;
+
+    simpbench_parse_opts(argc, argv, opts);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+    if (count > nprocs - 1) {
+        count = nprocs - 1;
+    }
+
+    /* put our data, but hold off on committing it */
+    value.type = PMIX_UINT64;
+    value.data.uint64 = myproc.rank;
+    if (PMIX_SUCCESS != (rc = PMIx_Put(PMIX_GLOBAL, STRESS_KEY, &value))) {
+        pmix_output(0, "Rank %d: PMIx_Put failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* ask for the data of the next "count" ranks - none of them
+     * have committed yet, so the server has to hold the requests */
+    for (n = 0; n < count; n++) {
+        target = (myproc.rank + 1 + n) % nprocs;
+        proc.rank = target;
+        rc = PMIx_Get_nb(&proc, STRESS_KEY, NULL, 0, valcbfunc, NULL);
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Rank %d: PMIx_Get_nb of rank %u failed: %s", myproc.rank, target,
+                        PMIx_Error_string(rc));
+            ++errors;
+            goto done;
+        }
+    }
+
+    /* give everyone a chance to post their requests */
+    sleep(sleeptime);
+
+    /* commit the data and time how long it takes to drain */
+    start = simpbench_usec();
+    if (PMIX_SUCCESS != (rc = PMIx_Commit())) {
+        pmix_output(0, "Rank %d: PMIx_Commit failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    while (getcount < count) {
+        struct timespec ts;
+        ts.tv_sec = 0;
+        ts.tv_nsec = 10000;
+        nanosleep(&ts, NULL);
+    }
+    drain = simpbench_usec() - start;
+
+    /* share our timing */
+    value.data.uint64 = drain;
+    PMIx_Put(PMIX_GLOBAL, "simpdmodexstress.drain", &value);
+    PMIx_Commit();
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    PMIX_INFO_LOAD(&info, PMIX_COLLECT_DATA, &flag, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, &info, 1))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == myproc.rank) {
+        fprintf(stdout, "Direct modex of %u procs with %lu outstanding gets each (%lu total)\n",
+                nprocs, count, nprocs * count);
+        report("Time to drain all gets", &proc, nprocs, "simpdmodexstress.drain");
+    }
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
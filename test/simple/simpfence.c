@@ -0,0 +1,136 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Fence driver: each rank puts a blob of the given size, commits, and
+ * then executes a number of fences that collect the data. Rank 0
+ * reports the fence-release latency and the peak RSS of both itself
+ * and the server (the simptest harness that launched us).
+ *
+ * Usage: simptest -n <nprocs> -e ./simpfence [-s bytes] [-i iterations]
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+static pmix_proc_t myproc;
+
+/* read the peak resident set size (in KB) of the given pid */
+static long peak_rss(pid_t pid)
+{
+    char path[64], line[256];
+    FILE *fp;
+    long val = -1;
+
+    snprintf(path, sizeof(path), "/proc/%d/status", (int) pid);
+    fp = fopen(path, "r");
+    if (NULL == fp) {
+        return -1;
+    }
+    while (NULL != fgets(line, sizeof(line), fp)) {
+        if (0 == strncmp(line, "VmHWM:", 6)) {
+            val = strtol(line + 6, NULL, 10);
+            break;
+        }
+    }
+    fclose(fp);
+    return val;
+}
+
+int main(int argc, char **argv)
+{
+    int rc, frc, i;
+    unsigned long niters = 10, blobsize = 1024 * 1024;
+    simpbench_opt_t opts[] = {{"-s", "--size", &blobsize},
+                              {"-i", "--iterations", &niters},
+                              {NULL, NULL, NULL}};
+    pmix_value_t value;
+    pmix_byte_object_t bo;
+    pmix_proc_t proc;
+    pmix_info_t info;
+    bool flag = true;
+    uint64_t start;
+    double usecs, total = 0.0, maxusecs = 0.0;
+    struct rusage usage;
+    long srvrss;
+
+    simpbench_parse_opts(argc, argv, opts);
+    if (0 == niters || INT_MAX < niters) {
+        niters = 1;
+    }
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* put our blob */
+    bo.bytes = (char *) malloc(blobsize);
+    bo.size = blobsize;
+    memset(bo.bytes, (int) (myproc.rank & 0xff), blobsize);
+    value.type = PMIX_BYTE_OBJECT;
+    value.data.bo = bo;
+    rc = PMIx_Put(PMIX_GLOBAL, "simpfence.blob", &value);
+    free(bo.bytes);
+    if (PMIX_SUCCESS != rc) {
+        pmix_output(0, "Rank %d: PMIx_Put failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Commit())) {
+        pmix_output(0, "Rank %d: PMIx_Commit failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+
+    /* time the fences */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    PMIX_INFO_LOAD(&info, PMIX_COLLECT_DATA, &flag, PMIX_BOOL);
+    for (i = 0; i < (int) niters; i++) {
+        start = simpbench_usec();
+        rc = PMIx_Fence(&proc, 1, &info, 1);
+        usecs = (double) (simpbench_usec() - start);
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+            goto done;
+        }
+        total += usecs;
+        if (usecs > maxusecs) {
+            maxusecs = usecs;
+        }
+    }
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == myproc.rank) {
+        getrusage(RUSAGE_SELF, &usage);
+        srvrss = peak_rss(getppid());
+        fprintf(stdout, "Fence with %lu byte blobs: avg %.3f msec max %.3f msec over %lu iterations\n",
+                blobsize, total / (1000.0 * niters), maxusecs / 1000.0, niters);
+        fprintf(stdout, "Peak RSS: client %ld KB server %ld KB\n", usage.ru_maxrss, srvrss);
+    }
+
+done:
+    /* keep the first failure so that simptest reports it */
+    if (PMIX_SUCCESS != (frc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(frc));
+        if (PMIX_SUCCESS == rc) {
+            rc = frc;
+        }
+    }
+    if (PMIX_SUCCESS != rc) {
+        return 1;
+    }
+    return (0);
+}
@@ -0,0 +1,126 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Get cache driver: every rank puts and commits one key, executes a
+ * fence that does NOT collect data, and then repeatedly asks its
+ * neighbor for that key and for one the neighbor never posted - the
+ * pattern of an app probing for optional endpoint info. Rank 0 reports
+ * the time per probe along with how many of its gets were satisfied
+ * locally, answered from the negative cache, or sent to the server.
+ *
+ * Compare runs with and without the cache, e.g.:
+ *
+ *   simptest -n 4 -e ./simpgetcache -i 1000
+ *   PMIX_MCA_pmix_client_get_cache=1 simptest -n 4 -e ./simpgetcache -i 1000
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+int main(int argc, char **argv)
+{
+    int rc;
+    pmix_proc_t myproc, proc;
+    pmix_value_t value, *val = NULL;
+    pmix_info_t info;
+    bool flag = true;
+    uint32_t nprocs, n;
+    unsigned long iters = 100;
+    simpbench_opt_t opts[] = {{"-i", "--iters", &iters}, {NULL, NULL, NULL}};
+    uint64_t start, elapsed;
+    int errors = 0;
+
+    simpbench_parse_opts(argc, argv, opts);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+
+    /* post our data and wait for everyone else to do the same */
+    value.type = PMIX_UINT64;
+    value.data.uint64 = myproc.rank;
+    if (PMIX_SUCCESS != (rc = PMIx_Put(PMIX_GLOBAL, "simpgetcache.present", &value))) {
+        pmix_output(0, "Rank %d: PMIx_Put failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Commit())) {
+        pmix_output(0, "Rank %d: PMIx_Commit failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* probe our neighbor - the server holds a get for a key a local
+     * proc hasn't posted until it times out, so ask it to answer
+     * the optional one immediately */
+    proc.rank = (myproc.rank + 1) % nprocs;
+    PMIX_INFO_LOAD(&info, PMIX_IMMEDIATE, &flag, PMIX_BOOL);
+    start = simpbench_usec();
+    for (n = 0; n < iters; n++) {
+        rc = PMIx_Get(&proc, "simpgetcache.present", NULL, 0, &val);
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Rank %d: PMIx_Get of rank %u failed: %s", myproc.rank, proc.rank,
+                        PMIx_Error_string(rc));
+            ++errors;
+            break;
+        }
+        PMIX_VALUE_RELEASE(val);
+        rc = PMIx_Get(&proc, "simpgetcache.absent", &info, 1, &val);
+        if (PMIX_ERR_NOT_FOUND != rc) {
+            pmix_output(0, "Rank %d: PMIx_Get of missing key returned %s", myproc.rank,
+                        PMIx_Error_string(rc));
+            ++errors;
+            break;
+        }
+    }
+    elapsed = simpbench_usec() - start;
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == myproc.rank) {
+        fprintf(stdout, "%lu probes: %lu usec (%.2f usec/probe)\n", iters,
+                (unsigned long) elapsed, (0 < iters) ? (double) elapsed / (double) iters : 0.0);
+        fprintf(stdout, "Gets satisfied locally %lu from negative cache %lu sent to server %lu\n",
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_GET_CACHE_HITS),
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_GET_NEGCACHE_HITS),
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_GET_SERVER_REQUESTS));
+    }
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Modex memory driver: each rank puts a blob of the given size, commits,
+ * and executes a collecting fence. Every rank then retrieves the blob of
+ * every other rank, after which the proportional set size (PSS) of each
+ * client is summed and reported by rank 0 together with that of the
+ * server (the simptest harness that launched us). PSS charges shared
+ * pages to each process in proportion, so the total approximates the
+ * memory the node spends on the job.
+ *
+ * Run once per storage component to compare them, e.g.:
+ *
+ *   PMIX_MCA_gds=hash  simptest -n 16 -e ./simpmodexmem -s 4096
+ *   PMIX_MCA_gds=shmem simptest -n 16 -e ./simpmodexmem -s 4096
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+static pmix_proc_t myproc;
+
+/* read the PSS of the given pid in KB, falling back to RSS if the
+ * kernel does not provide a rollup */
+static long node_mem(pid_t pid)
+{
+    char path[64], line[256];
+    FILE *fp;
+    long val = -1;
+
+    snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", (int) pid);
+    fp = fopen(path, "r");
+    if (NULL != fp) {
+        while (NULL != fgets(line, sizeof(line), fp)) {
+            if (0 == strncmp(line, "Pss:", 4)) {
+                val = strtol(line + 4, NULL, 10);
+                break;
+            }
+        }
+        fclose(fp);
+        if (0 <= val) {
+            return val;
+        }
+    }
+    snprintf(path, sizeof(path), "/proc/%d/status", (int) pid);
+    fp = fopen(path, "r");
+    if (NULL == fp) {
+        return -1;
+    }
+    while (NULL != fgets(line, sizeof(line), fp)) {
+        if (0 == strncmp(line, "VmRSS:", 6)) {
+            val = strtol(line + 6, NULL, 10);
+            break;
+        }
+    }
+    fclose(fp);
+    return val;
+}
+
+int main(int argc, char **argv)
+{
+    int rc, i;
+    unsigned long blobsize = 4096;
+    simpbench_opt_t opts[] = {{"-s", "--size", &blobsize}, {NULL, NULL, NULL}};
+    uint32_t nprocs;
+    pmix_value_t value, *val = NULL;
+    pmix_byte_object_t bo;
+    pmix_proc_t proc;
+    pmix_info_t info;
+    bool flag = true;
+    long mymem, total = 0, srvmem;
+    int errors = 0;
+
+    simpbench_parse_opts(argc, argv, opts);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+
+    /* put our blob */
+    bo.bytes = (char *) malloc(blobsize);
+    bo.size = blobsize;
+    memset(bo.bytes, (int) (myproc.rank & 0xff), blobsize);
+    value.type = PMIX_BYTE_OBJECT;
+    value.data.bo = bo;
+    rc = PMIx_Put(PMIX_GLOBAL, "simpmodexmem.blob", &value);
+    free(bo.bytes);
+    if (PMIX_SUCCESS != rc) {
+        pmix_output(0, "Rank %d: PMIx_Put failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Commit())) {
+        pmix_output(0, "Rank %d: PMIx_Commit failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+    PMIX_INFO_LOAD(&info, PMIX_COLLECT_DATA, &flag, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, &info, 1))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+
+    /* retrieve everyone else's blob */
+    for (i = 0; i < (int) nprocs; i++) {
+        if (i == (int) myproc.rank) {
+            continue;
+        }
+        proc.rank = i;
+        rc = PMIx_Get(&proc, "simpmodexmem.blob", NULL, 0, &val);
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Rank %d: PMIx_Get of rank %d blob failed: %s", myproc.rank, i,
+                        PMIx_Error_string(rc));
+            ++errors;
+            continue;
+        }
+        if (PMIX_BYTE_OBJECT != val->type || blobsize != val->data.bo.size
+            || (0 < blobsize && (char) (i & 0xff) != val->data.bo.bytes[0])) {
+            pmix_output(0, "Rank %d: rank %d blob is corrupt", myproc.rank, i);
+            ++errors;
+        }
+        PMIX_VALUE_RELEASE(val);
+    }
+
+    /* share our memory usage - the values are tiny and
+     * will not noticeably change what we are measuring */
+    mymem = node_mem(getpid());
+    value.type = PMIX_INT64;
+    value.data.int64 = mymem;
+    PMIx_Put(PMIX_GLOBAL, "simpmodexmem.mem", &value);
+    PMIx_Commit();
+    proc.rank = PMIX_RANK_WILDCARD;
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, &info, 1))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        goto done;
+    }
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == myproc.rank) {
+        srvmem = node_mem(getppid());
+        for (i = 0; i < (int) nprocs; i++) {
+            proc.rank = i;
+            if (PMIX_SUCCESS == PMIx_Get(&proc, "simpmodexmem.mem", NULL, 0, &val)) {
+                total += val->data.int64;
+                PMIX_VALUE_RELEASE(val);
+            }
+        }
+        fprintf(stdout, "Modex of %lu byte blobs across %u procs (gds=%s)\n",
+                (unsigned long) blobsize, nprocs,
+                (NULL == getenv("PMIX_MCA_gds")) ? "default" : getenv("PMIX_MCA_gds"));
+        fprintf(stdout, "Node memory: clients %ld KB server %ld KB total %ld KB\n", total,
+                srvmem, total + srvmem);
+    }
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
@@ -0,0 +1,122 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Direct modex prefetch driver: every rank puts and commits its data,
+ * executes a fence that does NOT collect data, and then walks the ranks
+ * that follow it in order, timing each PMIx_Get. This is the pattern
+ * of a ring or nearest-neighbor endpoint exchange right after init.
+ * Each rank then asks its server how many requests were satisfied from
+ * prefetched data, and rank 0 reports the results.
+ *
+ * Only gets for procs on other nodes go to the host, so run it across
+ * nodes with and without prefetch enabled, e.g.:
+ *
+ *   PMIX_MCA_pmix_server_dmodex_prefetch_depth=0  mpirun ... ./simpprefetch
+ *   PMIX_MCA_pmix_server_dmodex_prefetch_depth=16 mpirun ... ./simpprefetch
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+#define PREFETCH_KEY "simpprefetch.data"
+
+int main(int argc, char **argv)
+{
+    int rc;
+    pmix_proc_t myproc, proc;
+    pmix_value_t value, *val = NULL;
+    uint32_t nprocs, n;
+    unsigned long count = UINT32_MAX;
+    simpbench_opt_t opts[] = {{"-c", "--count", &count}, {NULL, NULL, NULL}};
+    uint64_t start, elapsed;
+    int errors = 0;
+
+    simpbench_parse_opts(argc, argv, opts);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+
+    /* get our job size */
+    PMIX_LOAD_PROCID(&proc, myproc.nspace, PMIX_RANK_WILDCARD);
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        pmix_output(0, "Rank %d: PMIx_Get job size failed: %s", myproc.rank,
+                    PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+    if (count > nprocs - 1) {
+        count = nprocs - 1;
+    }
+
+    /* post our data and wait for everyone else to do the same */
+    value.type = PMIX_UINT64;
+    value.data.uint64 = myproc.rank;
+    if (PMIX_SUCCESS != (rc = PMIx_Put(PMIX_GLOBAL, PREFETCH_KEY, &value))) {
+        pmix_output(0, "Rank %d: PMIx_Put failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Commit())) {
+        pmix_output(0, "Rank %d: PMIx_Commit failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Fence failed: %s", myproc.rank, PMIx_Error_string(rc));
+        ++errors;
+        goto done;
+    }
+
+    /* walk the ranks that follow us */
+    start = simpbench_usec();
+    for (n = 1; n <= count; n++) {
+        proc.rank = (myproc.rank + n) % nprocs;
+        rc = PMIx_Get(&proc, PREFETCH_KEY, NULL, 0, &val);
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Rank %d: PMIx_Get of rank %u failed: %s", myproc.rank, proc.rank,
+                        PMIx_Error_string(rc));
+            ++errors;
+            continue;
+        }
+        if (PMIX_UINT64 != val->type || proc.rank != val->data.uint64) {
+            pmix_output(0, "Rank %d: rank %u data is wrong", myproc.rank, proc.rank);
+            ++errors;
+        }
+        PMIX_VALUE_RELEASE(val);
+    }
+    elapsed = simpbench_usec() - start;
+
+    if (0 == myproc.rank) {
+        fprintf(stdout, "Sequential get of %lu ranks: %lu usec (%.1f usec/get)\n", count,
+                (unsigned long) elapsed, (0 < count) ? (double) elapsed / (double) count : 0.0);
+        fprintf(stdout, "Server prefetch hits %lu misses %lu\n",
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_DMODEX_PREFETCH_HITS),
+                (unsigned long) simpbench_query_counter(PMIX_QUERY_DMODEX_PREFETCH_MISSES));
+    }
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Integer encoding microbenchmark: rank 0 encodes and then decodes
+ * arrays of fixed-width integers with the selected psquash module,
+ * once a value at a time and once with the batch entry points, and
+ * reports the average time per value and encoded size for each. The
+ * batch output is checked to be byte-identical to the per-value
+ * output, and the decoded values are checked against the originals.
+ *
+ * Options are -n for the number of values in each array (default
+ * 100000) and -i for the number of passes averaged (default 10), e.g.:
+ *
+ *   simptest -n 1 -e ./simpsquash -n 1000000 -i 20
+ *
+ * The values are drawn from three ranges: small (all single byte when
+ * encoded), medium (two or three bytes), and the full range of the type.
+ */
+
+#include "src/include/pmix_config.h"
+#include "include/pmix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "src/mca/psquash/psquash.h"
+#include "src/util/pmix_output.h"
+
+#include "simpbench.h"
+
+static pmix_proc_t myproc;
+
+static uint64_t next_rand(uint64_t *state)
+{
+    /* xorshift - cheap and reproducible */
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/* fill the array with count values of the given size from the range */
+static void fill(uint8_t *src, size_t elsize, int32_t count, int range)
+{
+    uint64_t state = 88172645463325252ULL, val;
+    int32_t i;
+
+    for (i = 0; i < count; i++) {
+        val = next_rand(&state);
+        if (0 == range) {
+            val %= 100;
+        } else if (1 == range) {
+            val %= 100000;
+        }
+        /* the low bytes on either endianness */
+        switch (elsize) {
+        case 2: {
+            uint16_t v = (uint16_t) val;
+            memcpy(src + i * elsize, &v, elsize);
+            break;
+        }
+        case 4: {
+            uint32_t v = (uint32_t) val;
+            memcpy(src + i * elsize, &v, elsize);
+            break;
+        }
+        default:
+            memcpy(src + i * elsize, &val, elsize);
+            break;
+        }
+    }
+}
+
+/* encode and decode the array iters times each way, reporting the
+ * average ns per value for each direction */
+static int bench(const char *name, pmix_data_type_t type, size_t elsize, int range,
+                 int32_t count, int iters)
+{
+    pmix_status_t rc;
+    uint8_t *src, *dest, *enc, *benc;
+    double senc = 0.0, sdec = 0.0, benctime = 0.0, bdec = 0.0, start;
+    size_t max_size, pos = 0, len, blen = 0, used = 0;
+    int32_t j;
+    int i, ret = 1;
+
+    rc = pmix_psquash.get_max_size(type, &max_size);
+    if (PMIX_SUCCESS != rc) {
+        pmix_output(0, "Max size of %s failed: %s", name, PMIx_Error_string(rc));
+        return 1;
+    }
+    src = (uint8_t *) malloc(count * elsize);
+    dest = (uint8_t *) malloc(count * elsize);
+    enc = (uint8_t *) malloc(count * max_size);
+    benc = (uint8_t *) malloc(count * max_size);
+    fill(src, elsize, count, range);
+
+    for (i = 0; i < iters; i++) {
+        /* a value at a time */
+        start = simpbench_now();
+        for (j = 0, pos = 0; j < count; j++) {
+            rc = (pmix_psquash.encode_int)(type, src + j * elsize, enc + pos, &len);
+            if (PMIX_SUCCESS != rc) {
+                pmix_output(0, "Encode of %s failed: %s", name, PMIx_Error_string(rc));
+                goto cleanup;
+            }
+            pos += len;
+        }
+        senc += simpbench_now() - start;
+        memset(dest, 0, count * elsize);
+        start = simpbench_now();
+        for (j = 0, used = 0; j < count; j++) {
+            rc = (pmix_psquash.decode_int)(type, enc + used, pos - used, dest + j * elsize, &len);
+            if (PMIX_SUCCESS != rc) {
+                pmix_output(0, "Decode of %s failed: %s", name, PMIx_Error_string(rc));
+                goto cleanup;
+            }
+            used += len;
+        }
+        sdec += simpbench_now() - start;
+        if (0 != memcmp(src, dest, count * elsize)) {
+            pmix_output(0, "Decode of %s returned the wrong value", name);
+            goto cleanup;
+        }
+        if (NULL == pmix_psquash.encode_ints || NULL == pmix_psquash.decode_ints) {
+            continue;
+        }
+
+        /* the whole array at once */
+        start = simpbench_now();
+        rc = pmix_psquash.encode_ints(type, src, count, benc, &blen);
+        benctime += simpbench_now() - start;
+        if (PMIX_SUCCESS != rc) {
+            pmix_output(0, "Batch encode of %s failed: %s", name, PMIx_Error_string(rc));
+            goto cleanup;
+        }
+        if (blen != pos || 0 != memcmp(enc, benc, pos)) {
+            pmix_output(0, "Batch encode of %s differs from the per-value encoding", name);
+            goto cleanup;
+        }
+        memset(dest, 0, count * elsize);
+        start = simpbench_now();
+        rc = pmix_psquash.decode_ints(type, benc, blen, dest, count, &used);
+        bdec += simpbench_now() - start;
+        if (PMIX_SUCCESS != rc || used != blen) {
+            pmix_output(0, "Batch decode of %s failed: %s", name, PMIx_Error_string(rc));
+            goto cleanup;
+        }
+        if (0 != memcmp(src, dest, count * elsize)) {
+            pmix_output(0, "Batch decode of %s returned the wrong value", name);
+            goto cleanup;
+        }
+    }
+    fprintf(stdout,
+            "%-14s encode %7.2f/%7.2f ns/val  decode %7.2f/%7.2f ns/val  %5.2f bytes/val\n",
+            name, 1.0e9 * senc / ((double) iters * count),
+            1.0e9 * benctime / ((double) iters * count), 1.0e9 * sdec / ((double) iters * count),
+            1.0e9 * bdec / ((double) iters * count), (double) pos / count);
+    ret = 0;
+
+cleanup:
+    free(src);
+    free(dest);
+    free(enc);
+    free(benc);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int rc, iters = 10;
+    int32_t count = 100000;
+    int errors = 0;
+
+    simpbench_array_opts(argc, argv, &count, &iters);
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        pmix_output(0, "Rank %d: PMIx_Init failed: %s", myproc.rank, PMIx_Error_string(rc));
+        exit(1);
+    }
+    if (0 != myproc.rank) {
+        goto done;
+    }
+
+    fprintf(stdout, "Encoding %d values with %s, averaged over %d passes (per-value/batch)\n",
+            (int) count, pmix_psquash.name, iters);
+    errors += bench("UINT16 small", PMIX_UINT16, sizeof(uint16_t), 0, count, iters);
+    errors += bench("UINT16 full", PMIX_UINT16, sizeof(uint16_t), 2, count, iters);
+    errors += bench("INT32 small", PMIX_INT32, sizeof(int32_t), 0, count, iters);
+    errors += bench("INT32 medium", PMIX_INT32, sizeof(int32_t), 1, count, iters);
+    errors += bench("INT32 full", PMIX_INT32, sizeof(int32_t), 2, count, iters);
+    errors += bench("UINT32 small", PMIX_UINT32, sizeof(uint32_t), 0, count, iters);
+    errors += bench("UINT32 medium", PMIX_UINT32, sizeof(uint32_t), 1, count, iters);
+    errors += bench("UINT32 full", PMIX_UINT32, sizeof(uint32_t), 2, count, iters);
+    errors += bench("INT64 medium", PMIX_INT64, sizeof(int64_t), 1, count, iters);
+    errors += bench("INT64 full", PMIX_INT64, sizeof(int64_t), 2, count, iters);
+    errors += bench("SIZE small", PMIX_SIZE, sizeof(size_t), 0, count, iters);
+    errors += bench("SIZE medium", PMIX_SIZE, sizeof(size_t), 1, count, iters);
+
+done:
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Rank %d: PMIx_Finalize failed: %s\n", myproc.rank, PMIx_Error_string(rc));
+    }
+    if (0 < errors) {
+        return 1;
+    }
+    return (0);
+}
@@ -0,0 +1,139 @@
+/*
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ */
+
+/* Startup benchmark: time PMIx_Init, touch the job-level data, and report the
+ * init time and resident memory of every client. Rank 0 prints the min, avg,
+ * and max of each along with the gds modules the server offered us.
+ *
+ * To compare gds modules, run the same job size once with shared memory
+ * forced on and once with it forced off, e.g. for 1k, 10k, and 100k ranks:
+ *
+ *   PMIX_MCA_gds_shmem_enable=1 PMIX_MCA_gds_shmem_min_job_size=0 \
+ *       ./pmix_test -n 1000 -s 10 -e ./test_startup
+ *   PMIX_MCA_gds=hash ./pmix_test -n 1000 -s 10 -e ./test_startup
+ *
+ * and likewise with -n 10000 and -n 100000, raising -s so that each simulated
+ * node holds a realistic number of ranks. */
+
+#include "pmix.h"
+#include "test_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define STARTUP_INIT_KEY "test_startup.init_usec"
+#define STARTUP_MEM_KEY  "test_startup.mem_kb"
+
+/* proportional set size of this process in KB, falling back
+ * to the resident set size if the kernel lacks a rollup */
+static uint64_t my_mem_kb(void)
+{
+    const char *files[2] = {"/proc/self/smaps_rollup", "/proc/self/status"};
+    const char *tags[2] = {"Pss:", "VmRSS:"};
+    char line[256];
+    FILE *fp;
+    int n;
+
+    for (n = 0; n < 2; n++) {
+        fp = fopen(files[n], "r");
+        if (NULL == fp) {
+            continue;
+        }
+        while (NULL != fgets(line, sizeof(line), fp)) {
+            if (0 == strncmp(line, tags[n], strlen(tags[n]))) {
+                fclose(fp);
+                return strtoull(line + strlen(tags[n]), NULL, 10);
+            }
+        }
+        fclose(fp);
+    }
+    return 0;
+}
+
+static void report(const char *what, const char *units, pmix_proc_t *peer, uint32_t nprocs,
+                   const char *key, test_params *l_params, validation_params *v_params)
+{
+    pmix_value_t *val;
+    uint64_t min = UINT64_MAX, max = 0;
+    double sum = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < nprocs; i++) {
+        peer->rank = i;
+        PMIXT_CHECK(PMIx_Get(peer, key, NULL, 0, &val), (*l_params), (*v_params));
+        if (val->data.uint64 < min) {
+            min = val->data.uint64;
+        }
+        if (val->data.uint64 > max) {
+            max = val->data.uint64;
+        }
+        sum += (double) val->data.uint64;
+        PMIX_VALUE_RELEASE(val);
+    }
+    TEST_OUTPUT(("%s (%s): min %lu avg %.1f max %lu", what, units, (unsigned long) min,
+                 sum / (double) nprocs, (unsigned long) max));
+}
+
+int main(int argc, char *argv[])
+{
+    test_params l_params;
+    validation_params v_params;
+    pmix_proc_t this_proc, job_proc;
+    pmix_value_t value, *val;
+    pmix_info_t info;
+    struct timeval start, end;
+    uint64_t init_usec;
+    uint32_t nprocs;
+    bool flag = true;
+
+    pmixt_pre_init(argc, argv, &l_params, &v_params, NULL);
+
+    gettimeofday(&start, NULL);
+    PMIXT_CHECK(PMIx_Init(&this_proc, NULL, 0), l_params, v_params);
+    gettimeofday(&end, NULL);
+    init_usec = (uint64_t) ((end.tv_sec - start.tv_sec) * 1000000
+                            + (end.tv_usec - start.tv_usec));
+
+    pmixt_post_init(&this_proc, &l_params, &v_params);
+
+    /* touch the job-level data so that its cost shows up in our footprint */
+    PMIX_LOAD_PROCID(&job_proc, this_proc.nspace, PMIX_RANK_WILDCARD);
+    PMIXT_CHECK(PMIx_Get(&job_proc, PMIX_JOB_SIZE, NULL, 0, &val), l_params, v_params);
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+    PMIXT_CHECK(PMIx_Get(&job_proc, PMIX_LOCAL_PEERS, NULL, 0, &val), l_params, v_params);
+    PMIX_VALUE_RELEASE(val);
+    job_proc.rank = (this_proc.rank + 1) % nprocs;
+    PMIXT_CHECK(PMIx_Get(&job_proc, PMIX_HOSTNAME, NULL, 0, &val), l_params, v_params);
+    PMIX_VALUE_RELEASE(val);
+
+    /* share our numbers */
+    value.type = PMIX_UINT64;
+    value.data.uint64 = init_usec;
+    PMIXT_CHECK(PMIx_Put(PMIX_GLOBAL, STARTUP_INIT_KEY, &value), l_params, v_params);
+    value.data.uint64 = my_mem_kb();
+    PMIXT_CHECK(PMIx_Put(PMIX_GLOBAL, STARTUP_MEM_KEY, &value), l_params, v_params);
+    PMIXT_CHECK(PMIx_Commit(), l_params, v_params);
+    job_proc.rank = PMIX_RANK_WILDCARD;
+    PMIX_INFO_LOAD(&info, PMIX_COLLECT_DATA, &flag, PMIX_BOOL);
+    PMIXT_CHECK(PMIx_Fence(&job_proc, 1, &info, 1), l_params, v_params);
+    PMIX_INFO_DESTRUCT(&info);
+
+    if (0 == this_proc.rank) {
+        TEST_OUTPUT(("Startup of %u procs (offered gds=%s)", nprocs,
+                     (NULL == getenv("PMIX_GDS_MODULE")) ? "default" : getenv("PMIX_GDS_MODULE")));
+        report("PMIx_Init time", "usec", &job_proc, nprocs, STARTUP_INIT_KEY, &l_params, &v_params);
+        report("Client memory", "KB", &job_proc, nprocs, STARTUP_MEM_KEY, &l_params, &v_params);
+    }
+
+    PMIXT_CHECK(PMIx_Finalize(NULL, 0), l_params, v_params);
+
+    pmixt_post_finalize(&this_proc, &l_params, &v_params);
+}